@@ -1,8 +1,10 @@
 #include <game/Game.hpp>
 #include <game/PlacementMove.hpp>
 #include <minmax/MinMaxStrategy.hpp>
+#include <minmax/SearchStatistics.hpp>
 
 #include <util/Log.hpp>
+#include <util/ThreadPool.hpp>
 
 #include <chrono>
 
@@ -13,6 +15,19 @@ std::uint64_t executionTime(const std::function<void()>& function) {
 	return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 }
 
+void logSearchStatistics(const Alphalcazar::Strategy::MinMax::SearchStatistics& statistics) {
+	for (std::size_t ply = 0; ply < statistics.NodesPerPly.size(); ply++) {
+		Alphalcazar::Utils::LogInfo("  Ply {}: {} nodes", ply, statistics.NodesPerPly[ply]);
+	}
+	Alphalcazar::Utils::LogInfo("  {} nodes ({:.0f} per second, effective branching factor {:.2f}), {} leaf evaluations, {} repetitions",
+		statistics.GetNodes(), statistics.GetNodesPerSecond(), statistics.GetEffectiveBranchingFactor(), statistics.LeafEvaluations, statistics.Repetitions);
+	Alphalcazar::Utils::LogInfo("  {} cutoffs, {} of them by the first move", statistics.Cutoffs, statistics.CutoffsByMoveIndex[0]);
+	for (const auto& rootMove : statistics.RootMoves) {
+		const auto timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(rootMove.Time).count();
+		Alphalcazar::Utils::LogInfo("  Root move {}: {} nodes in {}ms", rootMove.Move, rootMove.Nodes, timeMs);
+	}
+}
+
 void runMinMaxFirstTurnBenchmark(const Alphalcazar::Game::Game& game, Alphalcazar::Strategy::MinMax::Depth depth, bool multithreaded) {
 	Alphalcazar::Strategy::MinMax::MinMaxStrategy strategy{ depth, multithreaded };
 	const auto executionTimeMs = executionTime([&strategy, &game]() {
@@ -20,6 +35,9 @@ void runMinMaxFirstTurnBenchmark(const Alphalcazar::Game::Game& game, Alphalcaza
 	});
 	const auto score = strategy.GetLastExecutedMoveScore();
 	Alphalcazar::Utils::LogInfo("First move at depth {} took {}ms and calculated a score of {}", depth, executionTimeMs, score);
+	if constexpr (Alphalcazar::Strategy::MinMax::c_CollectSearchStatistics) {
+		logSearchStatistics(strategy.GetLastSearchStatistics());
+	}
 }
 
 void runMinMaxFullGameBenchmark(Alphalcazar::Game::Game& game, Alphalcazar::Strategy::MinMax::Depth depth, bool multithreaded) {
@@ -31,14 +49,30 @@ void runMinMaxFullGameBenchmark(Alphalcazar::Game::Game& game, Alphalcazar::Stra
 	Alphalcazar::Utils::LogInfo("Game at depth {} took {}ms ended with result {}", depth, executionTimeMs, static_cast<int>(result));
 }
 
+void logThreadPoolStatistics(const Alphalcazar::Utils::ThreadPool& threadPool) {
+	const auto statistics = threadPool.GetStatistics();
+	for (std::size_t i = 0; i < statistics.Workers.size(); i++) {
+		const auto& worker = statistics.Workers[i];
+		const auto busyTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(worker.BusyTime).count();
+		const auto idleTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(worker.IdleTime).count();
+		Alphalcazar::Utils::LogInfo("Worker {} ran {} tasks ({} stolen) and was busy for {}ms, idle for {}ms", i, worker.ExecutedTasks, worker.StolenTasks, busyTimeMs, idleTimeMs);
+	}
+	const auto total = statistics.GetTotal();
+	Alphalcazar::Utils::LogInfo("The thread pool ran {} tasks ({} by waiting threads), with a median latency under {}us and a 99th percentile latency under {}us",
+		total.ExecutedTasks, statistics.Helpers.ExecutedTasks, statistics.GetTaskLatencyPercentile(0.5).count(), statistics.GetTaskLatencyPercentile(0.99).count());
+}
+
 void runMinMaxBenchmarks() {
 	constexpr Alphalcazar::Strategy::MinMax::Depth c_MaxDepth = 5;
 	constexpr bool c_MultithreadedBenchmark = true;
+	// All strategies share the same thread pool, which is started here so that its startup is not measured
+	Alphalcazar::Utils::ThreadPool::GetShared();
 	for (Alphalcazar::Strategy::MinMax::Depth depth = 1; depth <= c_MaxDepth; depth++) {
 		Alphalcazar::Game::Game game{};
 		runMinMaxFirstTurnBenchmark(game, depth, c_MultithreadedBenchmark);
 		runMinMaxFullGameBenchmark(game, depth, c_MultithreadedBenchmark);
 	}
+	logThreadPoolStatistics(Alphalcazar::Utils::ThreadPool::GetShared());
 }
 
 int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
@@ -0,0 +1,55 @@
+#include <game/BatchSimulator.hpp>
+#include <game/Game.hpp>
+#include <game/PlayoutEngine.hpp>
+
+#include <util/Log.hpp>
+#include <util/Random.hpp>
+
+#include <chrono>
+#include <functional>
+
+std::uint64_t executionTime(const std::function<void()>& function) {
+	const auto start = std::chrono::high_resolution_clock::now();
+	function();
+	const auto end = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+using ResultCounts = Alphalcazar::Game::BatchSimulator::GameResultCounts;
+
+void logPlayouts(const char* name, std::size_t games, std::uint64_t executionTimeUs, const ResultCounts& results) {
+	const double gamesPerSecond = static_cast<double>(games) * 1e6 / static_cast<double>(executionTimeUs);
+	Alphalcazar::Utils::LogInfo("{}: {} games in {}ms ({:.0f} per second), {} won by player one, {} by player two, {} draws",
+		name, games, executionTimeUs / 1000, gamesPerSecond, results[2], results[3], results[1]);
+}
+
+void runPlayoutEngineBenchmark(std::size_t games, std::size_t maxTurns) {
+	Alphalcazar::Game::PlayoutEngine engine{ 0 };
+	ResultCounts results{};
+	const auto executionTimeUs = executionTime([&]() {
+		for (std::size_t i = 0; i < games; i++) {
+			Alphalcazar::Game::Game game{};
+			results[static_cast<std::size_t>(engine.Play(game, maxTurns))]++;
+		}
+	});
+	logPlayouts("PlayoutEngine", games, executionTimeUs, results);
+}
+
+void runBatchSimulatorBenchmark(std::size_t games, std::size_t maxTurns) {
+	Alphalcazar::Utils::Xoshiro256 randomGenerator{ 0 };
+	Alphalcazar::Game::BatchSimulator simulator;
+	ResultCounts results{};
+	const auto executionTimeUs = executionTime([&]() {
+		results = simulator.PlayOuts(Alphalcazar::Game::Game{}, games, randomGenerator, maxTurns);
+	});
+	logPlayouts("BatchSimulator", games, executionTimeUs, results);
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+	// Random playouts from the starting position, as run for the leaves of the searches
+	constexpr std::size_t c_Games = 1 << 16;
+	constexpr std::size_t c_MaxTurns = 100;
+	runPlayoutEngineBenchmark(c_Games, c_MaxTurns);
+	runBatchSimulatorBenchmark(c_Games, c_MaxTurns);
+	return 0;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "aliases.hpp"
+#include "parameters.hpp"
+#include "PieceScoreTable.hpp"
+#include "PlacementMove.hpp"
+#include <util/Random.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace Alphalcazar::Game {
+	class Board;
+	class Game;
+
+	/// The amount of games simulated at once by a \ref BatchSimulator. 32 one-byte lanes fill a 256-bit AVX2 register.
+	constexpr std::size_t c_BatchSimulatorLaneCount = 32;
+
+	/*!
+	 * \brief Simulates many independent games at once, advancing all of them in lockstep.
+	 *
+	 * The state of the games is stored as a structure of arrays, with one lane per game: every piece holds the tile it
+	 * is on as a bitboard (one bit per tile), and its movement direction. All lanes play their placement moves at the
+	 * same time and the turns that complete are resolved together, one piece type at a time, following the same rules
+	 * as \ref Board::ExecuteMoves. Lanes that are finished, or that are in the middle of a turn, are masked out of the
+	 * turn resolution.
+	 *
+	 * Every stage, including the movement of the pieces, is a branch-free loop over the lanes: a piece movement computes
+	 * for every lane the mask of the tiles whose pieces move one step (the piece, the pushed chain or the pushed piece)
+	 * and the mask of the tiles whose pieces are removed from play, then shifts the bitboards of all pieces under those
+	 * masks. The compiler vectorizes these loops. Meant for bulk workloads such as random rollouts, dataset generation
+	 * or rule statistics, where simulating games one by one through \ref Game leaves most of the vector hardware idle.
+	 */
+	class BatchSimulator {
+	public:
+		template<typename T>
+		using LaneArray = std::array<T, c_BatchSimulatorLaneCount>;
+		/// The amount of games that ended with every result, indexed by \ref GameResult
+		using GameResultCounts = std::array<std::size_t, static_cast<std::size_t>(GameResult::PLAYER_TWO_WINS) + 1>;
+
+		/// Creates a simulator with all lanes at the starting position of a game
+		BatchSimulator();
+
+		/// Sets all lanes back to the starting position of a game
+		void Reset();
+
+		/// Sets the lane to the position of the specified game
+		void SetGame(std::size_t lane, const Game& game);
+
+		/*!
+		 * \brief Plays a placement move on every lane whose game is not finished yet, for the active player of the lane.
+		 *
+		 * Invalid moves are passes, and moves are expected to be legal (as with \ref Game::PlayNextPlacementMove).
+		 * The lanes on which the move completed a turn then execute the board moves of the turn in lockstep.
+		 */
+		void PlayPlacementMoves(const LaneArray<PlacementMove>& moves);
+
+		/*!
+		 * \brief Returns a uniformly random legal move for the active player of every lane, sampled the same way as
+		 *        \ref PlayoutEngine::SampleMove. Finished lanes, and lanes whose active player can't place a piece, pass.
+		 */
+		LaneArray<PlacementMove> SampleMoves(Utils::Xoshiro256& randomGenerator) const;
+
+		/*!
+		 * \brief Plays all lanes from their current position until their game ends, with random moves.
+		 *
+		 * \param maxTurns The maximum amount of turns to play on each lane. Lanes that reach it are scored as a draw.
+		 *
+		 * \returns The results of the games of all lanes.
+		 */
+		const LaneArray<GameResult>& PlayOut(Utils::Xoshiro256& randomGenerator, std::size_t maxTurns);
+
+		/*!
+		 * \brief Plays the specified amount of games from the position of a game, with random moves, and counts their results.
+		 *
+		 * Unlike \ref PlayOut, a lane starts the next game as soon as its game ends, so that all lanes keep playing until the
+		 * last games instead of waiting for the longest game of the batch. The lanes are left in an unspecified state.
+		 *
+		 * \param maxTurns The maximum amount of turns to play on each game. Games that reach it are scored as a draw.
+		 */
+		GameResultCounts PlayOuts(const Game& game, std::size_t games, Utils::Xoshiro256& randomGenerator, std::size_t maxTurns);
+
+		/*!
+		 * \brief Returns the result of the game of every lane.
+		 *
+		 * On top of the win conditions of \ref Board::GetResult, a game is a draw once neither player can place a piece
+		 * and no piece moves at the end of a turn. \ref Game has no such rule, but the position then repeats every turn,
+		 * which \ref Game::FastForward scores as a draw once it finds the loop a few turns later: the result is the same,
+		 * without playing the turns in between. Longer loops are not detected, and reach the turn limit of \ref PlayOut.
+		 */
+		const LaneArray<GameResult>& GetResults() const;
+		/// Returns whether the games of all lanes are finished
+		bool AllFinished() const;
+		/// Returns the turn the game of the lane is currently on
+		std::uint16_t GetTurn(std::size_t lane) const;
+		/// Returns the player that has to play the next placement move of the lane
+		PlayerId GetActivePlayer(std::size_t lane) const;
+		/// Builds a board with the pieces of the lane
+		Board GetBoard(std::size_t lane) const;
+	private:
+		/*!
+		 * \brief Executes the board moves of a turn on all lanes of the mask, one piece type after the other,
+		 *        and evaluates their results.
+		 */
+		void ExecuteMoves(const LaneArray<std::uint8_t>& mask);
+
+		/*!
+		 * \brief Executes the movement of the piece of the specified type on all lanes of the mask, for the player with
+		 *        initiative or for the other one.
+		 *
+		 * Sets the lanes on which any piece moved or was removed from play in the changed mask.
+		 */
+		void ExecutePieceMoves(const LaneArray<std::uint8_t>& mask, std::size_t pieceTypeIndex, std::uint8_t secondPlayer, LaneArray<std::uint8_t>& changed);
+
+		/// Returns, for every lane, the bitboard of the tiles holding a piece of the specified player
+		LaneArray<std::uint32_t> GetPlayerPieceBits(PlayerId playerId) const;
+
+		/// Returns, for every lane, a mask of the free perimeter tiles (in the same order as \ref Board::GetLegalPlacementMask)
+		LaneArray<std::uint16_t> GetLegalPlacementMasks() const;
+
+		/// Returns, for every lane, a mask of the pieces in hand of the specified player (bit i set for the piece type i + 1)
+		LaneArray<std::uint8_t> GetPiecesInHandMasks(const LaneArray<std::uint8_t>& playerTwo) const;
+
+		/*!
+		 * \brief The tile of every piece slot of every lane, as a bitboard with the bit \ref GetTileIndex set, or 0 if the
+		 *        piece is not in play. The slot of a piece is its type minus one, plus \ref c_PieceTypes for pieces of player two.
+		 */
+		alignas(32) std::array<LaneArray<std::uint32_t>, c_PieceTypes * 2> mPieceBits;
+		/// The movement direction of every piece slot of every lane, only meaningful while the piece is in play
+		alignas(32) std::array<LaneArray<Direction>, c_PieceTypes * 2> mPieceDirections;
+		/// Whether player two has the initiative on every lane
+		alignas(32) LaneArray<std::uint8_t> mPlayerTwoInitiative;
+		/// Whether the first placement move of the current turn has already been played on every lane
+		alignas(32) LaneArray<std::uint8_t> mFirstMoveExecuted;
+		/// The result of the game of every lane
+		alignas(32) LaneArray<GameResult> mResults;
+		/// The turn every lane is currently on
+		LaneArray<std::uint16_t> mTurns;
+	};
+}
@@ -4,6 +4,9 @@
 #include "Coordinates.hpp"
 #include "parameters.hpp"
 #include "Tile.hpp"
+#include "PieceScoreTable.hpp"
+#include "PieceFeatureTable.hpp"
+#include "zobrist.hpp"
 #include "util/StaticVector.hpp"
 
 #include <array>
@@ -61,6 +64,13 @@ namespace Alphalcazar::Game {
 		std::array<const Tile*, c_PerimeterTileCount> GetPerimeterTiles() const;
 		/// Returns a list of all coordinates where a player may legally place a piece on their turn
 		Utils::StaticVector<Coordinates, c_PerimeterTileCount> GetLegalPlacementCoordinates() const;
+		/*!
+		 * \brief Returns a mask of the perimeter tiles where a player may legally place a piece on their turn.
+		 *
+		 * Bit i is set if the tile at the i-th coordinates of \ref Coordinates::GetPerimeterCoordinates is free.
+		 * Cheaper than \ref GetLegalPlacementCoordinates if the coordinates don't need to be listed.
+		 */
+		std::uint16_t GetLegalPlacementMask() const;
 
 		/// Returns the tile a given piece is placed on, or nullptr if the specified piece is not on the board
 		Tile* GetPieceTile(const Piece& piece);
@@ -94,6 +104,51 @@ namespace Alphalcazar::Game {
 		 * \param player The player for which the piece placements will be returned
 		 */
 		std::bitset<c_PieceTypes> GetPiecePlacements(PlayerId player) const;
+
+		/*!
+		 * \brief Returns a mask of the board (non-perimeter) tiles that hold a piece of the specified player.
+		 *
+		 * The bit of each tile is given by \ref GetBoardTileBitIndex. Together with \ref GetRowMaskResult, it allows
+		 * checking the win conditions without looping over the tiles of every row.
+		 */
+		std::uint16_t GetBoardTileMask(PlayerId player) const;
+
+		/*!
+		 * \brief Returns a zobrist hash of the pieces on the board, their positions and their directions.
+		 *
+		 * Two boards with the same pieces placed on the same tiles, facing the same directions, will always have the same hash.
+		 */
+		PositionHash GetHash() const;
+
+		/*!
+		 * \brief Enables (or disables, if nullptr) the incremental accumulation of the scores of the pieces in play.
+		 *
+		 * While a table is set, the board keeps the sum of the table scores of all pieces of player one minus the table
+		 * scores of all pieces of player two up to date whenever a piece is placed, moved or removed. Reading it with
+		 * \ref GetAccumulatedPieceScore is then O(1), instead of having to loop over all pieces.
+		 *
+		 * \note The table is not copied, so it must outlive the board (and all copies of the board).
+		 */
+		void SetPieceScoreTable(const PieceScoreTable* table);
+		/// Returns the piece score table set with \ref SetPieceScoreTable, or nullptr if the score accumulation is disabled
+		const PieceScoreTable* GetPieceScoreTable() const;
+		/// Returns the accumulated score of the pieces in play (from player one's perspective). See \ref SetPieceScoreTable
+		std::int32_t GetAccumulatedPieceScore() const;
+
+		/*!
+		 * \brief Enables (or disables, if nullptr) the incremental accumulation of the weights of the active piece features.
+		 *
+		 * While a table is set, the board keeps the sum of the weights of the active feature of every piece (see
+		 * \ref PieceFeatureTable) up to date whenever a piece is placed, moved or removed, by only subtracting the weights of
+		 * the features the piece leaves and adding the ones it enters.
+		 *
+		 * \note The table is not copied, so it must outlive the board (and all copies of the board).
+		 */
+		void SetPieceFeatureTable(const PieceFeatureTable* table);
+		/// Returns the piece feature table set with \ref SetPieceFeatureTable, or nullptr if the feature accumulation is disabled
+		const PieceFeatureTable* GetPieceFeatureTable() const;
+		/// Returns the accumulated weights of the active piece features. See \ref SetPieceFeatureTable
+		const PieceFeatureWeights& GetAccumulatedPieceFeatures() const;
 	private:
 		/*!
 		 * \brief Executes one piece movement, if the specified piece is on the board
@@ -155,6 +210,13 @@ namespace Alphalcazar::Game {
 		 */
 		void FetchPiecesFromIndexRange(std::size_t min, std::size_t max, bool excludePerimeter, const std::function<void(const Coordinates& coordinates, const Piece& piece)>& action) const;
 
+		/// Adds the table score of a piece at the given coordinates to the accumulated piece score, if score accumulation is enabled
+		void AddAccumulatedPieceScore(const Piece& piece, const Coordinates& coordinates);
+		/// Subtracts the table score of a piece at the given coordinates from the accumulated piece score, if score accumulation is enabled
+		void SubtractAccumulatedPieceScore(const Piece& piece, const Coordinates& coordinates);
+		/// Replaces the weights of a feature with the ones of another in the accumulated piece features, if feature accumulation is enabled
+		void ReplaceAccumulatedPieceFeature(std::size_t removedFeature, std::size_t addedFeature);
+
 		/// 2D array containing all tiles of the board (both perimeter and board tiles) indexed by their coordinates
 		std::array<std::array<Tile, c_PlayAreaSize>, c_PlayAreaSize> mTiles;
 		/*!
@@ -167,5 +229,13 @@ namespace Alphalcazar::Game {
 		 * a piece is located without having to loop over all the tiles.
 		 */
 		std::array<Coordinates, c_PieceTypes * 2> mPlacedPieceCoordinates;
+		/// The table used to accumulate piece scores, or nullptr if the accumulation is disabled. See \ref SetPieceScoreTable
+		const PieceScoreTable* mPieceScoreTable = nullptr;
+		/// The accumulated score of the pieces in play, from player one's perspective. See \ref SetPieceScoreTable
+		std::int32_t mAccumulatedPieceScore = 0;
+		/// The table used to accumulate piece features, or nullptr if the accumulation is disabled. See \ref SetPieceFeatureTable
+		const PieceFeatureTable* mPieceFeatureTable = nullptr;
+		/// The accumulated weights of the active piece features. See \ref SetPieceFeatureTable
+		PieceFeatureWeights mAccumulatedPieceFeatures {};
 	};
 }
@@ -5,10 +5,29 @@
 #include <fmt/format.h>
 #include <array>
 #include <limits>
+#include <utility>
 
 namespace Alphalcazar::Game {
 	constexpr Coordinate c_InvalidCoordinate = std::numeric_limits<Coordinate>::max();
 
+	/*!
+	 * \brief The x/y offsets each direction represents.
+	 *
+	 * \note Each direction offset should be located at the index of its corresponding \ref Direction value. If
+	 *       the Direction enum is re-ordered, so should this array.
+	 */
+	constexpr std::array<std::pair<Coordinate, Coordinate>, static_cast<std::size_t>(Direction::SIZE)> c_DirectionOffsets = {{
+		{ 0, 0 }, // NONE
+		{ 0, 1 }, // NORTH
+		{ 0, -1 }, // SOUTH
+		{ 1, 0 }, // EAST
+		{ -1, 0 }, // WEST
+		{ 1, -1 }, // SOUTH_EAST
+		{ -1, -1 }, // SOUTH_WEST
+		{ 1, 1 }, // NORTH_EAST
+		{ -1, 1 }, // NORTH_WEST
+	}};
+
 	/*!
 	 * \brief Helper class to work with the 2D coordinate system of the tiles of the board.
 	 *
@@ -20,7 +39,7 @@ namespace Alphalcazar::Game {
 		Coordinate x = c_InvalidCoordinate;
 		Coordinate y = c_InvalidCoordinate;
 
-		bool operator==(const Coordinates& coord) const {
+		constexpr bool operator==(const Coordinates& coord) const {
 			// Since at all calls of this function, all relevant values are loaded in the L1 cache,
 			// we parallelize the comparisons to avoid branching (causing a potential instruction-level cache miss)
 			const bool xIsEqual = x == coord.x;
@@ -28,22 +47,22 @@ namespace Alphalcazar::Game {
 			return xIsEqual && yIsEqual;
 		}
 
-		bool operator!=(const Coordinates& coord) const {
+		constexpr bool operator!=(const Coordinates& coord) const {
 			return x != coord.x || y != coord.y;
 		}
 
 		/// Indicates if the coordinates represent a valid play area tile.
-		bool IsPlayArea() const {
+		constexpr bool IsPlayArea() const {
 			return x >= 0 && x < c_PlayAreaSize&& y >= 0 && y < c_PlayAreaSize && !IsCorner();
 		}
 
 		/// Indicates if the coordinates represent a position in the perimeter of the board
-		bool IsPerimeter() const {
+		constexpr bool IsPerimeter() const {
 			return x == 0 || x == c_PlayAreaSize - 1 || y == 0 || y == c_PlayAreaSize - 1;
 		}
 
 		/// Indicates if the coordinates represent the center of the board
-		bool IsCenter() const {
+		constexpr bool IsCenter() const {
 			// Since at all calls of this function, all relevant values are loaded in the L1 cache,
 			// we parallelize the comparisons to avoid branching (causing a potential instruction-level cache miss)
 			const bool xIsCenter = x == c_CenterCoordinate;
@@ -52,12 +71,12 @@ namespace Alphalcazar::Game {
 		}
 
 		/// Indicates if the coordinates represent a tile that is on either the row or column that contains the center tile of the board
-		bool IsOnCenterLane() const {
+		constexpr bool IsOnCenterLane() const {
 			return x == c_CenterCoordinate || y == c_CenterCoordinate;
 		}
 
 		/// Indicates if the coordinates represent a corner of the play area. No tile will exist at these coordinates.
-		bool IsCorner() const {
+		constexpr bool IsCorner() const {
 			// Since at all calls of this function, all relevant values are loaded in the L1 cache,
 			// we parallelize the comparisons to avoid branching (causing a potential instruction-level cache miss)
 			const bool xIsPerimeter = x == 0 || x == c_PlayAreaSize - 1;
@@ -66,12 +85,12 @@ namespace Alphalcazar::Game {
 		}
 
 		/// Indicates if the coordinates represent a corner of the board
-		bool IsBoardCorner() const {
+		constexpr bool IsBoardCorner() const {
 			return (x == 1 || x == c_BoardSize) && (y == 1 || y == c_BoardSize);
 		}
 
 		/// Returns whether the current coordinates are valid
-		bool Valid() const {
+		constexpr bool Valid() const {
 			// Since at all calls of this function, all relevant values are loaded in the L1 cache,
 			// we parallelize the comparisons to avoid branching (causing a potential instruction-level cache miss)
 			const bool xIsInvalid = x != c_InvalidCoordinate;
@@ -36,16 +36,41 @@ namespace Alphalcazar::Game {
 		GameResult Play(Strategy& firstPlayerStrategy, Strategy& secondPlayerStrategy);
 		/// Plays out a single round of the game, given the player strategies to execute
 		GameResult PlayTurn(Strategy& firstPlayerStrategy, Strategy& secondPlayerStrategy);
+		/*!
+		 * \brief Plays out all upcoming turns in which neither player is able to place a piece.
+		 *
+		 * Those turns are fully deterministic (only the board movements are executed), so they can be resolved without
+		 * consulting any strategy. Stops as soon as the game ends or a player regains a legal placement move, or once the
+		 * positions are found to loop, which takes at most twice as many turns as it takes for the first position to repeat.
+		 * A loop is considered a draw, as the game would otherwise never end. Doesn't allocate any memory.
+		 *
+		 * \note Does nothing if the first placement move of the current turn has already been executed.
+		 *
+		 * \returns The game result after the fast-forwarded turns, or GameResult::NONE if the game has not ended.
+		 */
+		GameResult FastForward();
 		/*!
 		 * \brief Plays out the next step of a turn
 		 *
-		 * \param move The placement move of the active player.
+		 * \param move The placement move of the active player. An invalid move means the active player passes,
+		 *             which should only happen if they have no legal moves available.
 		 *
 		 * \returns The game result after the end of the turn if this function executed
 		 *          the second placement move of the turn, or GameState::NONE otherwise.
 		 */
 		GameResult PlayNextPlacementMove(const PlacementMove& move);
 
+		/// Returns whether the specified player has at least one legal placement move available
+		bool HasLegalMoves(PlayerId player) const;
+
+		/*!
+		 * \brief Returns a zobrist hash of the current position of the game.
+		 *
+		 * Includes the state of the board, which player has the initiative and whether the first move of the turn has been
+		 * executed. The turn number is not included, so that repeated positions can be detected.
+		 */
+		PositionHash GetHash() const;
+
 		/// Returns the ID of the player that needs to play next
 		PlayerId GetActivePlayer() const;
 		/// Returns the ID of the player has the corresponding initiative this turn (goes first or goes second, depending on the value of \param initiative)
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "game/aliases.hpp"
+#include "game/parameters.hpp"
+#include "game/PieceScoreTable.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace Alphalcazar::Game {
+	/// The amount of piece slots of the feature set: one for each piece of each player
+	constexpr std::size_t c_PieceFeatureSlots = c_PieceTypes * 2;
+	/// The amount of movement directions a piece can have (north, south, east and west)
+	constexpr std::size_t c_PieceFeatureDirections = 4;
+	/// The amount of features of a piece slot while the piece is in play: one for each tile of the play area and direction
+	constexpr std::size_t c_PieceFeaturesPerSlot = c_TileIndexCount * c_PieceFeatureDirections;
+	/// The index of the first "piece in hand" feature. Each piece slot has one, active while the piece is not in play.
+	constexpr std::size_t c_PieceHandFeatureOffset = c_PieceFeatureSlots * c_PieceFeaturesPerSlot;
+	/// The amount of features of the feature set. Each piece slot always has exactly one active feature.
+	constexpr std::size_t c_PieceFeatureCount = c_PieceHandFeatureOffset + c_PieceFeatureSlots;
+	/// The amount of weights of each feature, which is the amount of values the board accumulates (see \ref Board::SetPieceFeatureTable)
+	constexpr std::size_t c_PieceFeatureWeights = 32;
+
+	/// The weights of a single feature
+	using PieceFeatureWeights = std::array<std::int16_t, c_PieceFeatureWeights>;
+
+	/*!
+	 * \brief A table with the weights of every feature, such as the first layer of a neural network.
+	 *
+	 * Entries are indexed by \ref GetPieceFeature and \ref GetPieceHandFeature. See \ref Board::SetPieceFeatureTable.
+	 */
+	using PieceFeatureTable = std::array<PieceFeatureWeights, c_PieceFeatureCount>;
+
+	/// Returns the piece slot of the piece of the given player and type
+	constexpr std::size_t GetPieceFeatureSlot(PlayerId owner, PieceType pieceType) {
+		return (owner == PlayerId::PLAYER_ONE ? 0 : c_PieceTypes) + pieceType - 1;
+	}
+
+	/// Returns the feature of a piece in play on the given tile, facing the given (cardinal) direction
+	constexpr std::size_t GetPieceFeature(PlayerId owner, PieceType pieceType, const Coordinates& coordinates, Direction direction) {
+		// Pieces only move along the cardinal directions, which are the first ones after Direction::NONE
+		const std::size_t directionIndex = static_cast<std::size_t>(direction) - 1;
+		return GetPieceFeatureSlot(owner, pieceType) * c_PieceFeaturesPerSlot + GetTileIndex(coordinates) * c_PieceFeatureDirections + directionIndex;
+	}
+
+	/// Returns the feature of a piece that is not in play
+	constexpr std::size_t GetPieceHandFeature(PlayerId owner, PieceType pieceType) {
+		return c_PieceHandFeatureOffset + GetPieceFeatureSlot(owner, pieceType);
+	}
+}
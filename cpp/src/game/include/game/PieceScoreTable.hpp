@@ -0,0 +1,33 @@
+#pragma once
+
+#include "game/aliases.hpp"
+#include "game/parameters.hpp"
+#include "game/Coordinates.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace Alphalcazar::Game {
+	/// The amount of tiles (including the non-existing corners) of the play area, indexed by \ref GetTileIndex
+	constexpr std::size_t c_TileIndexCount = c_PlayAreaSize * c_PlayAreaSize;
+
+	/// Returns a unique index, from 0 to \ref c_TileIndexCount (exclusive), for the tile at the given (valid) coordinates
+	constexpr std::size_t GetTileIndex(const Coordinates& coordinates) {
+		return static_cast<std::size_t>(coordinates.x * c_PlayAreaSize + coordinates.y);
+	}
+
+	/// The amount of entries of a \ref PieceScoreTable
+	constexpr std::size_t c_PieceScoreTableSize = c_TileIndexCount * static_cast<std::size_t>(Direction::SIZE) * c_PieceTypes;
+
+	/*!
+	 * \brief A table with a score for every piece type on every tile and movement direction.
+	 *
+	 * Entries are indexed by \ref GetPieceScoreTableIndex. See \ref Board::SetPieceScoreTable.
+	 */
+	using PieceScoreTable = std::array<std::int32_t, c_PieceScoreTableSize>;
+
+	/// Returns the index of the \ref PieceScoreTable entry of a piece type placed on the given tile, facing the given direction
+	constexpr std::size_t GetPieceScoreTableIndex(const Coordinates& coordinates, Direction direction, PieceType pieceType) {
+		return (GetTileIndex(coordinates) * static_cast<std::size_t>(Direction::SIZE) + static_cast<std::size_t>(direction)) * c_PieceTypes + pieceType - 1;
+	}
+}
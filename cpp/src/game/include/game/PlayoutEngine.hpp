@@ -0,0 +1,60 @@
+#pragma once
+
+#include "aliases.hpp"
+#include "PlacementMove.hpp"
+#include <util/Random.hpp>
+
+#include <cstdint>
+
+namespace Alphalcazar::Game {
+	class Game;
+
+	/// Returns the position of the n-th (0-based) set bit of a mask, which must have more than n bits set
+	std::uint32_t GetNthSetBitIndex(std::uint32_t mask, std::uint32_t n);
+
+	/// Returns the amount of set bits of a mask
+	std::uint32_t GetSetBitCount(std::uint32_t mask);
+
+	/*!
+	 * \brief Plays out games with uniformly random placement moves, as fast as possible.
+	 *
+	 * Unlike running a game with random strategies, the playouts don't go through the \ref Strategy interface,
+	 * don't build lists of legal moves and use a small seedable generator, so they don't allocate any memory.
+	 * Playouts with the same seed and starting position are fully reproducible.
+	 */
+	class PlayoutEngine {
+	public:
+		explicit PlayoutEngine(std::uint64_t seed);
+
+		/*!
+		 * \brief Plays the game from its current position until it ends, with a random move for each placement.
+		 *
+		 * \param game The game to play out, which is modified in place.
+		 * \param maxTurns The maximum amount of turns to play. Playouts that reach it are scored as a draw.
+		 *
+		 * \returns The result of the game.
+		 */
+		GameResult Play(Game& game, std::size_t maxTurns);
+
+		/*!
+		 * \brief Returns a uniformly random legal move of the active player of the game,
+		 *        or an invalid move (a pass) if they have no legal moves.
+		 *
+		 * The move is sampled directly from the masks of free perimeter tiles and pieces in hand.
+		 */
+		PlacementMove SampleMove(const Game& game);
+
+		/*!
+		 * \brief Plays the next placement move of the game and, if it completed a turn, fast-forwards the game through the
+		 *        following turns in which neither player can place a piece (see \ref Game::FastForward).
+		 *
+		 * \returns The result of the game after playing the move.
+		 */
+		static GameResult PlayMove(Game& game, const PlacementMove& move);
+
+		/// Returns the random generator of the engine, to make other random decisions reproducible with the same seed
+		Utils::Xoshiro256& GetRandomGenerator();
+	private:
+		Utils::Xoshiro256 mRandomGenerator;
+	};
+}
@@ -2,11 +2,70 @@
 
 #include "aliases.hpp"
 #include "parameters.hpp"
+#include "PlacementMove.hpp"
 #include <util/StaticVector.hpp>
+#include <util/StopToken.hpp>
+#include <util/TaskLatch.hpp>
+
+#include <memory>
+
+namespace Alphalcazar::Utils {
+	class ThreadPool;
+}
 
 namespace Alphalcazar::Game {
 	class Game;
-	struct PlacementMove;
+
+	/*!
+	 * \brief Handle of a strategy running in the background, see \ref Strategy::ExecuteAsync.
+	 *
+	 * Destroying the handle before the move is retrieved cancels the execution, without waiting for the strategy to return.
+	 */
+	class StrategyExecution {
+	public:
+		/// The state shared by the handle and the task running the strategy, which keeps it alive if the handle is destroyed first
+		struct State {
+			/// Counts the task running the strategy
+			Utils::TaskLatch Done;
+			/// The move returned by the strategy, once Done is
+			PlacementMove Move;
+		};
+
+		StrategyExecution(std::shared_ptr<State> state, Utils::ThreadPool& threadPool, const Utils::StopToken& stopToken);
+		~StrategyExecution();
+
+		StrategyExecution(StrategyExecution&&) = default;
+		/// Cancels the execution of this handle, if it is still running, before taking over the other one
+		StrategyExecution& operator=(StrategyExecution&& other);
+
+		/*!
+		 * \brief Asks the strategy to stop and to return the best move it has found so far as soon as possible.
+		 *
+		 * Does not wait for the strategy. Strategies that don't support stopping (see \ref Strategy::ExecuteStoppable)
+		 * run until they are done.
+		 */
+		void Cancel();
+
+		/// Returns whether the move of the strategy is ready, without waiting for it
+		bool IsReady() const;
+
+		/*!
+		 * \brief Waits for the strategy and returns its move. Can only be called once.
+		 *
+		 * The calling thread runs the strategy itself if no worker of the thread pool has picked it up yet (see \ref Utils::ThreadPool::Wait).
+		 */
+		PlacementMove Get();
+
+		/// Returns the stop token of the execution, which also carries its deadline
+		const Utils::StopToken& GetStopToken() const;
+	private:
+		/// The state shared with the task running the strategy, or nullptr once the move has been retrieved
+		std::shared_ptr<State> mState;
+		/// The thread pool running the strategy
+		Utils::ThreadPool* mThreadPool;
+		/// The token the strategy polls to know if it has to stop
+		Utils::StopToken mStopToken;
+	};
 
 	/*!
 	 * \brief Virtual class that represents how players will decide which move to play on their turn.
@@ -29,5 +88,27 @@ namespace Alphalcazar::Game {
 		 * \returns The move to be executed.
 		 */
 		virtual PlacementMove Execute(PlayerId playerId, const Utils::StaticVector<PlacementMove, c_MaxLegalMovesCount>& legalMoves, const Game& game) = 0;
+
+		/*!
+		 * \brief Same as \ref Execute, but returns early once a stop is requested on the token (or its deadline passes).
+		 *
+		 * A stopped strategy still returns one of the legal moves: the best one it found before being stopped.
+		 * The default implementation ignores the token and calls \ref Execute.
+		 */
+		virtual PlacementMove ExecuteStoppable(PlayerId playerId, const Utils::StaticVector<PlacementMove, c_MaxLegalMovesCount>& legalMoves, const Game& game, const Utils::StopToken& stopToken);
+
+		/*!
+		 * \brief Runs \ref ExecuteStoppable as a task of a thread pool and returns a handle to its move, which can be used to cancel it.
+		 *
+		 * The legal moves and the game are copied, so they don't need to outlive the call. Running the strategies on a thread
+		 * pool instead of a thread each keeps the amount of threads fixed, however many executions run at once.
+		 *
+		 * \param deadline The point in time at which the strategy stops and returns the best move it has found so far.
+		 * \param threadPool The thread pool running the strategy, or nullptr to use the shared one (see \ref Utils::ThreadPool::GetShared).
+		 *
+		 * \note The strategy must not be executed again, nor destroyed, until the execution is done (see \ref StrategyExecution::IsReady),
+		 *       even if the handle was destroyed before.
+		 */
+		StrategyExecution ExecuteAsync(PlayerId playerId, const Utils::StaticVector<PlacementMove, c_MaxLegalMovesCount>& legalMoves, const Game& game, Utils::StopToken::Clock::time_point deadline = Utils::StopToken::Clock::time_point::max(), Utils::ThreadPool* threadPool = nullptr);
 	};
 }
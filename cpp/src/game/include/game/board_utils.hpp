@@ -2,7 +2,9 @@
 
 #include "game/aliases.hpp"
 #include "game/parameters.hpp"
+#include "game/Coordinates.hpp"
 #include <array>
+#include <cstdint>
 
 namespace Alphalcazar::Game {
 	/*!
@@ -50,4 +52,47 @@ namespace Alphalcazar::Game {
 
 		return result;
 	}
+
+	static_assert(c_BoardSize * c_BoardSize <= 16, "The board tiles don't fit in a board tile mask");
+
+	/// Returns the index of the bit of the board (non-perimeter) tile at the given coordinates in a board tile mask (see \ref Board::GetBoardTileMask)
+	constexpr std::size_t GetBoardTileBitIndex(Coordinate x, Coordinate y) {
+		return static_cast<std::size_t>((x - 1) * c_BoardSize + (y - 1));
+	}
+
+	/// Returns the board tile masks of all rows that need to be checked for win conditions, in the order of \ref GetAllRowIterationDirections
+	constexpr std::array<std::uint16_t, c_RowIterationDirectionsCount> GetAllRowMasks() {
+		std::array<std::uint16_t, c_RowIterationDirectionsCount> result{};
+		constexpr auto rows = GetAllRowIterationDirections();
+		for (std::size_t i = 0; i < rows.size(); i++) {
+			const auto& [x, y, direction, length] = rows[i];
+			const auto& [xOffset, yOffset] = c_DirectionOffsets[static_cast<std::size_t>(direction)];
+			for (Coordinate distance = 0; distance < length; distance++) {
+				result[i] |= static_cast<std::uint16_t>(1 << GetBoardTileBitIndex(x + xOffset * distance, y + yOffset * distance));
+			}
+		}
+		return result;
+	}
+
+	/*!
+	 * \brief Returns the game result of a board from the board tile masks of the pieces of each player.
+	 *
+	 * Gives the same result as \ref Board::GetResult, but only needs a few bit operations per row.
+	 */
+	constexpr GameResult GetRowMaskResult(std::uint16_t playerOneMask, std::uint16_t playerTwoMask) {
+		constexpr auto rowMasks = GetAllRowMasks();
+		bool playerOneRow = false;
+		bool playerTwoRow = false;
+		for (const std::uint16_t rowMask : rowMasks) {
+			playerOneRow |= (playerOneMask & rowMask) == rowMask;
+			playerTwoRow |= (playerTwoMask & rowMask) == rowMask;
+		}
+		if (playerOneRow && playerTwoRow) {
+			return c_AcceptDraws ? GameResult::DRAW : GameResult::NONE;
+		}
+		if (playerOneRow) {
+			return GameResult::PLAYER_ONE_WINS;
+		}
+		return playerTwoRow ? GameResult::PLAYER_TWO_WINS : GameResult::NONE;
+	}
 }
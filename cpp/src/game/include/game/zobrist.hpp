@@ -0,0 +1,66 @@
+#pragma once
+
+#include "game/aliases.hpp"
+#include "game/parameters.hpp"
+#include "game/Coordinates.hpp"
+#include "game/PieceScoreTable.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace Alphalcazar::Game {
+	/// A hash that identifies a position of the game (board and turn state)
+	using PositionHash = std::uint64_t;
+
+	/// The amount of zobrist keys used for each piece: one for every combination of play area tile and movement direction
+	constexpr std::size_t c_ZobristKeysPerPiece = c_TileIndexCount * static_cast<std::size_t>(Direction::SIZE);
+
+	/// The random keys that are combined (with XOR) to build a \ref PositionHash
+	struct ZobristKeys {
+		/// One key per piece, tile and direction. Pieces are indexed like the placed piece coordinates of the \ref Board.
+		std::array<PositionHash, c_PieceTypes * 2 * c_ZobristKeysPerPiece> Pieces{};
+		/// Key that is set when player two has the initiative
+		PositionHash PlayerTwoInitiative = 0;
+		/// Key that is set when the first placement move of the turn has already been executed
+		PositionHash FirstMoveExecuted = 0;
+	};
+
+	/// Returns the next value of a splitmix64 pseudo-random sequence and advances its state
+	constexpr std::uint64_t SplitMix64(std::uint64_t& state) {
+		state += 0x9E3779B97F4A7C15ULL;
+		std::uint64_t result = state;
+		result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		result = (result ^ (result >> 27)) * 0x94D049BB133111EBULL;
+		return result ^ (result >> 31);
+	}
+
+	/*!
+	 * \brief Generates all zobrist keys.
+	 *
+	 * The keys are generated at compile time from a fixed seed, so that the hash of a given position
+	 * is stable across runs and platforms.
+	 */
+	constexpr ZobristKeys GenerateZobristKeys() {
+		ZobristKeys keys{};
+		std::uint64_t state = 0x416C7068616C6361ULL;
+		for (auto& key : keys.Pieces) {
+			key = SplitMix64(state);
+		}
+		keys.PlayerTwoInitiative = SplitMix64(state);
+		keys.FirstMoveExecuted = SplitMix64(state);
+		return keys;
+	}
+
+	constexpr ZobristKeys c_ZobristKeys = GenerateZobristKeys();
+
+	/*!
+	 * \brief Returns the index of the \ref ZobristKeys::Pieces key of a piece at the given position.
+	 *
+	 * \param pieceIndex The index of the piece, from 0 to 2 * \ref c_PieceTypes (exclusive). The pieces of player one come first.
+	 * \param coordinates The (valid) coordinates at which the piece is placed.
+	 * \param direction The movement direction of the piece.
+	 */
+	constexpr std::size_t GetZobristPieceKeyIndex(std::size_t pieceIndex, const Coordinates& coordinates, Direction direction) {
+		return (pieceIndex * c_TileIndexCount + GetTileIndex(coordinates)) * static_cast<std::size_t>(Direction::SIZE) + static_cast<std::size_t>(direction);
+	}
+}
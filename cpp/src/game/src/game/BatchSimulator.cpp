@@ -0,0 +1,486 @@
+#include "game/BatchSimulator.hpp"
+
+#include "game/Board.hpp"
+#include "game/Coordinates.hpp"
+#include "game/Game.hpp"
+#include "game/Piece.hpp"
+#include "game/PlayoutEngine.hpp"
+#include "game/board_utils.hpp"
+
+namespace {
+	using namespace Alphalcazar::Game;
+
+	/// The amount of piece slots of a lane: one per piece type and player
+	constexpr std::size_t c_SlotCount = c_PieceTypes * 2;
+
+	constexpr Coordinates GetTileCoordinates(std::size_t tile) {
+		return { static_cast<Coordinate>(tile / c_PlayAreaSize), static_cast<Coordinate>(tile % c_PlayAreaSize) };
+	}
+
+	constexpr std::uint32_t GetTileBit(const Coordinates& coordinates) {
+		return std::uint32_t{ 1 } << GetTileIndex(coordinates);
+	}
+
+	/// For every direction, the bitboard of the tiles that have a neighbor in that direction
+	constexpr auto c_StepSourceBits = [] {
+		std::array<std::uint32_t, static_cast<std::size_t>(Direction::SIZE)> result{};
+		for (std::size_t direction = 1; direction < static_cast<std::size_t>(Direction::SIZE); direction++) {
+			const auto& [xOffset, yOffset] = c_DirectionOffsets[direction];
+			for (std::size_t tile = 0; tile < c_TileIndexCount; tile++) {
+				const Coordinates coordinates = GetTileCoordinates(tile);
+				const Coordinates neighbor { coordinates.x + xOffset, coordinates.y + yOffset };
+				if (coordinates.IsPlayArea() && neighbor.IsPlayArea()) {
+					result[direction] |= GetTileBit(coordinates);
+				}
+			}
+		}
+		return result;
+	}();
+
+	/// The amount of bits a bitboard is shifted left, and then right, to move its tiles one step in a direction
+	struct StepShifts {
+		std::uint32_t Left = 0;
+		std::uint32_t Right = 0;
+	};
+
+	/// The \ref StepShifts of every direction
+	constexpr auto c_StepShifts = [] {
+		std::array<StepShifts, static_cast<std::size_t>(Direction::SIZE)> result{};
+		for (std::size_t direction = 0; direction < static_cast<std::size_t>(Direction::SIZE); direction++) {
+			const auto& [xOffset, yOffset] = c_DirectionOffsets[direction];
+			const int offset = xOffset * static_cast<int>(c_PlayAreaSize) + yOffset;
+			result[direction].Left = static_cast<std::uint32_t>(offset > 0 ? offset : 0);
+			result[direction].Right = static_cast<std::uint32_t>(offset < 0 ? -offset : 0);
+		}
+		return result;
+	}();
+
+	/// The bitboard of the perimeter tiles
+	constexpr std::uint32_t c_PerimeterBits = [] {
+		std::uint32_t result = 0;
+		for (const auto& coordinates : Coordinates::GetPerimeterCoordinates()) {
+			result |= GetTileBit(coordinates);
+		}
+		return result;
+	}();
+
+	/// The bitboard of the tiles of the board, where pieces stay in play after moving
+	constexpr std::uint32_t c_BoardBits = [] {
+		std::uint32_t result = 0;
+		for (std::size_t tile = 0; tile < c_TileIndexCount; tile++) {
+			if (const Coordinates coordinates = GetTileCoordinates(tile); coordinates.IsPlayArea() && !coordinates.IsPerimeter()) {
+				result |= GetTileBit(coordinates);
+			}
+		}
+		return result;
+	}();
+
+	/// The tile indices of the perimeter tiles, in the order of \ref Coordinates::GetPerimeterCoordinates
+	constexpr auto c_PerimeterTileIndices = [] {
+		std::array<std::uint8_t, c_PerimeterTileCount> result{};
+		constexpr auto perimeterCoordinates = Coordinates::GetPerimeterCoordinates();
+		for (std::size_t i = 0; i < perimeterCoordinates.size(); i++) {
+			result[i] = static_cast<std::uint8_t>(GetTileIndex(perimeterCoordinates[i]));
+		}
+		return result;
+	}();
+
+	/// The bitboards of every row, column and diagonal that completes the win condition, see \ref GetAllRowIterationDirections
+	constexpr auto c_BoardRowBits = [] {
+		std::array<std::uint32_t, c_RowIterationDirectionsCount> result{};
+		constexpr auto rows = GetAllRowIterationDirections();
+		for (std::size_t row = 0; row < rows.size(); row++) {
+			const auto& [xOffset, yOffset] = c_DirectionOffsets[static_cast<std::size_t>(rows[row].Direction)];
+			for (Coordinate distance = 0; distance < c_BoardSize; distance++) {
+				result[row] |= GetTileBit({ rows[row].x + xOffset * distance, rows[row].y + yOffset * distance });
+			}
+		}
+		return result;
+	}();
+
+	/// The directions pieces move in, see \ref Coordinates::GetLegalPlacementDirection
+	constexpr std::array<Direction, 4> c_MovementDirections { Direction::NORTH, Direction::SOUTH, Direction::EAST, Direction::WEST };
+
+	/// Moves the tiles of a bitboard one step in the direction, dropping the tiles that would leave the play area
+	constexpr std::uint32_t StepBits(std::uint32_t bits, Direction direction) {
+		const StepShifts& shifts = c_StepShifts[static_cast<std::size_t>(direction)];
+		return ((bits & c_StepSourceBits[static_cast<std::size_t>(direction)]) << shifts.Left) >> shifts.Right;
+	}
+
+	/// Returns a mask with all bits set if the condition holds, so that lanes select values without branching
+	constexpr std::uint32_t MaskIf(bool condition) {
+		return 0U - static_cast<std::uint32_t>(condition);
+	}
+
+	constexpr PieceType GetSlotPieceType(std::size_t slot) {
+		return static_cast<PieceType>(slot % c_PieceTypes + 1);
+	}
+}
+
+namespace Alphalcazar::Game {
+	BatchSimulator::BatchSimulator() {
+		Reset();
+	}
+
+	void BatchSimulator::Reset() {
+		for (auto& pieceBits : mPieceBits) {
+			pieceBits.fill(0);
+		}
+		for (auto& pieceDirection : mPieceDirections) {
+			pieceDirection.fill(Direction::NONE);
+		}
+		mPlayerTwoInitiative.fill(0);
+		mFirstMoveExecuted.fill(0);
+		mResults.fill(GameResult::NONE);
+		mTurns.fill(0);
+	}
+
+	void BatchSimulator::SetGame(std::size_t lane, const Game& game) {
+		for (std::size_t slot = 0; slot < c_SlotCount; slot++) {
+			mPieceBits[slot][lane] = 0;
+			mPieceDirections[slot][lane] = Direction::NONE;
+		}
+		for (const auto& [coordinates, piece] : game.GetBoard().GetPieces()) {
+			const std::size_t slot = piece.GetType() - 1 + (piece.GetOwner() == PlayerId::PLAYER_TWO ? c_PieceTypes : 0);
+			mPieceBits[slot][lane] = GetTileBit(coordinates);
+			mPieceDirections[slot][lane] = piece.GetMovementDirection();
+		}
+
+		const GameState& state = game.GetState();
+		mPlayerTwoInitiative[lane] = state.PlayerWithInitiative == PlayerId::PLAYER_TWO;
+		mFirstMoveExecuted[lane] = state.FirstMoveExecuted;
+		mTurns[lane] = state.Turn;
+		mResults[lane] = game.GetBoard().GetResult();
+	}
+
+	void BatchSimulator::PlayPlacementMoves(const LaneArray<PlacementMove>& moves) {
+		alignas(32) LaneArray<std::uint8_t> turnCompleted{};
+		bool anyTurnCompleted = false;
+		for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+			if (mResults[lane] != GameResult::NONE) {
+				continue;
+			}
+
+			if (const auto& move = moves[lane]; move.Valid()) {
+				const bool playerTwo = mPlayerTwoInitiative[lane] != mFirstMoveExecuted[lane];
+				const std::size_t slot = move.PieceType - 1 + (playerTwo ? c_PieceTypes : 0);
+				mPieceBits[slot][lane] = GetTileBit(move.Coordinates);
+				mPieceDirections[slot][lane] = move.Coordinates.GetLegalPlacementDirection();
+			}
+
+			if (mFirstMoveExecuted[lane]) {
+				turnCompleted[lane] = 1;
+				anyTurnCompleted = true;
+			} else {
+				mFirstMoveExecuted[lane] = 1;
+			}
+		}
+
+		if (anyTurnCompleted) {
+			ExecuteMoves(turnCompleted);
+		}
+	}
+
+	BatchSimulator::LaneArray<PlacementMove> BatchSimulator::SampleMoves(Utils::Xoshiro256& randomGenerator) const {
+		alignas(32) LaneArray<std::uint8_t> activePlayerTwo;
+		for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+			activePlayerTwo[lane] = mPlayerTwoInitiative[lane] ^ mFirstMoveExecuted[lane];
+		}
+		const auto tileMasks = GetLegalPlacementMasks();
+		const auto pieceMasks = GetPiecesInHandMasks(activePlayerTwo);
+
+		constexpr auto perimeterCoordinates = Coordinates::GetPerimeterCoordinates();
+		LaneArray<PlacementMove> moves;
+		for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+			const std::uint32_t tileCount = GetSetBitCount(tileMasks[lane]);
+			const std::uint32_t pieceCount = GetSetBitCount(pieceMasks[lane]);
+			if (mResults[lane] != GameResult::NONE || tileCount == 0 || pieceCount == 0) {
+				continue;
+			}
+
+			const std::uint32_t moveIndex = randomGenerator.NextBounded(tileCount * pieceCount);
+			const auto& coordinates = perimeterCoordinates[GetNthSetBitIndex(tileMasks[lane], moveIndex / pieceCount)];
+			const PieceType pieceType = static_cast<PieceType>(GetNthSetBitIndex(pieceMasks[lane], moveIndex % pieceCount) + 1);
+			moves[lane] = { coordinates, pieceType };
+		}
+		return moves;
+	}
+
+	const BatchSimulator::LaneArray<GameResult>& BatchSimulator::PlayOut(Utils::Xoshiro256& randomGenerator, std::size_t maxTurns) {
+		LaneArray<std::size_t> lastTurns;
+		for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+			lastTurns[lane] = mTurns[lane] + maxTurns;
+		}
+
+		while (true) {
+			for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+				if (mResults[lane] == GameResult::NONE && mTurns[lane] >= lastTurns[lane]) {
+					mResults[lane] = GameResult::DRAW;
+				}
+			}
+			if (AllFinished()) {
+				break;
+			}
+			PlayPlacementMoves(SampleMoves(randomGenerator));
+		}
+		return mResults;
+	}
+
+	BatchSimulator::GameResultCounts BatchSimulator::PlayOuts(const Game& game, std::size_t games, Utils::Xoshiro256& randomGenerator, std::size_t maxTurns) {
+		GameResultCounts resultCounts{};
+		const std::size_t lastTurn = game.GetState().Turn + maxTurns;
+		// Lanes without a game left to play are left finished, and their results are not counted
+		alignas(32) LaneArray<std::uint8_t> playing{};
+		std::size_t startedGames = 0;
+		for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+			if (startedGames < games) {
+				SetGame(lane, game);
+				playing[lane] = 1;
+				startedGames++;
+			} else {
+				mResults[lane] = GameResult::DRAW;
+			}
+		}
+
+		while (true) {
+			bool anyPlaying = false;
+			for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+				if (!playing[lane]) {
+					continue;
+				}
+				if (mResults[lane] == GameResult::NONE && mTurns[lane] >= lastTurn) {
+					mResults[lane] = GameResult::DRAW;
+				}
+				if (mResults[lane] != GameResult::NONE) {
+					resultCounts[static_cast<std::size_t>(mResults[lane])]++;
+					if (startedGames == games) {
+						playing[lane] = 0;
+						continue;
+					}
+					SetGame(lane, game);
+					startedGames++;
+				}
+				anyPlaying = true;
+			}
+			if (!anyPlaying) {
+				break;
+			}
+			PlayPlacementMoves(SampleMoves(randomGenerator));
+		}
+		return resultCounts;
+	}
+
+	const BatchSimulator::LaneArray<GameResult>& BatchSimulator::GetResults() const {
+		return mResults;
+	}
+
+	bool BatchSimulator::AllFinished() const {
+		for (const GameResult result : mResults) {
+			if (result == GameResult::NONE) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	std::uint16_t BatchSimulator::GetTurn(std::size_t lane) const {
+		return mTurns[lane];
+	}
+
+	PlayerId BatchSimulator::GetActivePlayer(std::size_t lane) const {
+		return mPlayerTwoInitiative[lane] != mFirstMoveExecuted[lane] ? PlayerId::PLAYER_TWO : PlayerId::PLAYER_ONE;
+	}
+
+	Board BatchSimulator::GetBoard(std::size_t lane) const {
+		Board board;
+		for (std::size_t slot = 0; slot < c_SlotCount; slot++) {
+			if (const std::uint32_t bits = mPieceBits[slot][lane]; bits != 0) {
+				const Piece piece { slot < c_PieceTypes ? PlayerId::PLAYER_ONE : PlayerId::PLAYER_TWO, GetSlotPieceType(slot) };
+				board.PlacePiece(GetTileCoordinates(GetNthSetBitIndex(bits, 0)), piece, mPieceDirections[slot][lane]);
+			}
+		}
+		return board;
+	}
+
+	void BatchSimulator::ExecuteMoves(const LaneArray<std::uint8_t>& mask) {
+		// The pieces move in the same order as in Board::ExecuteMoves: by type, and for each type first the piece of the player with initiative.
+		// Every step moves the same piece type on all lanes, so the lanes stay in lockstep.
+		alignas(32) LaneArray<std::uint8_t> changed{};
+		for (std::size_t pieceTypeIndex = 0; pieceTypeIndex < c_PieceTypes; pieceTypeIndex++) {
+			for (std::uint8_t secondPlayer = 0; secondPlayer <= 1; secondPlayer++) {
+				ExecutePieceMoves(mask, pieceTypeIndex, secondPlayer, changed);
+			}
+		}
+
+		// Win conditions of all lanes, see Board::GetResult
+		const auto playerOneBits = GetPlayerPieceBits(PlayerId::PLAYER_ONE);
+		const auto playerTwoBits = GetPlayerPieceBits(PlayerId::PLAYER_TWO);
+		alignas(32) LaneArray<std::uint8_t> playerOneRows{};
+		alignas(32) LaneArray<std::uint8_t> playerTwoRows{};
+		for (const std::uint32_t rowBits : c_BoardRowBits) {
+			for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+				playerOneRows[lane] |= static_cast<std::uint8_t>((playerOneBits[lane] & rowBits) == rowBits);
+				playerTwoRows[lane] |= static_cast<std::uint8_t>((playerTwoBits[lane] & rowBits) == rowBits);
+			}
+		}
+
+		alignas(32) LaneArray<std::uint8_t> playerTwo;
+		playerTwo.fill(1);
+		const auto tileMasks = GetLegalPlacementMasks();
+		const auto playerOnePieceMasks = GetPiecesInHandMasks({});
+		const auto playerTwoPieceMasks = GetPiecesInHandMasks(playerTwo);
+
+		for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+			if (!mask[lane]) {
+				continue;
+			}
+			mTurns[lane]++;
+			mFirstMoveExecuted[lane] = 0;
+			mPlayerTwoInitiative[lane] ^= 1;
+
+			GameResult result = GameResult::NONE;
+			if (playerOneRows[lane] && playerTwoRows[lane]) {
+				if constexpr (c_AcceptDraws) {
+					result = GameResult::DRAW;
+				}
+			} else if (playerOneRows[lane]) {
+				result = GameResult::PLAYER_ONE_WINS;
+			} else if (playerTwoRows[lane]) {
+				result = GameResult::PLAYER_TWO_WINS;
+			} else if (!changed[lane] && (tileMasks[lane] == 0 || (playerOnePieceMasks[lane] == 0 && playerTwoPieceMasks[lane] == 0))) {
+				// No piece moved and no piece can be placed, so the position repeats every turn (see GetResults)
+				result = GameResult::DRAW;
+			}
+			mResults[lane] = result;
+		}
+	}
+
+	void BatchSimulator::ExecutePieceMoves(const LaneArray<std::uint8_t>& mask, std::size_t pieceTypeIndex, std::uint8_t secondPlayer, LaneArray<std::uint8_t>& changed) {
+		const PieceType pieceType = static_cast<PieceType>(pieceTypeIndex + 1);
+		const bool pusher = pieceType == c_PusherPieceType;
+		const bool pushable = pieceType == c_PushablePieceType;
+		const auto& playerOnePieceBits = mPieceBits[pieceTypeIndex];
+		const auto& playerTwoPieceBits = mPieceBits[pieceTypeIndex + c_PieceTypes];
+		const auto& playerOneDirections = mPieceDirections[pieceTypeIndex];
+		const auto& playerTwoDirections = mPieceDirections[pieceTypeIndex + c_PieceTypes];
+		const auto& playerOnePushableBits = mPieceBits[c_PushablePieceType - 1];
+		const auto& playerTwoPushableBits = mPieceBits[c_PushablePieceType - 1 + c_PieceTypes];
+
+		alignas(32) LaneArray<std::uint32_t> occupiedBits{};
+		for (const auto& pieceBits : mPieceBits) {
+			for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+				occupiedBits[lane] |= pieceBits[lane];
+			}
+		}
+
+		// The moving piece of every lane, and a mask per movement direction with all bits set on the lanes the piece moves in
+		alignas(32) LaneArray<std::uint32_t> originBits;
+		alignas(32) std::array<LaneArray<std::uint32_t>, c_MovementDirections.size()> directionMasks;
+		for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+			const std::uint32_t playerTwo = MaskIf(mPlayerTwoInitiative[lane] != secondPlayer);
+			originBits[lane] = ((playerTwoPieceBits[lane] & playerTwo) | (playerOnePieceBits[lane] & ~playerTwo)) & MaskIf(mask[lane] != 0);
+			const auto direction = static_cast<std::uint32_t>((static_cast<std::uint32_t>(playerTwoDirections[lane]) & playerTwo)
+				| (static_cast<std::uint32_t>(playerOneDirections[lane]) & ~playerTwo));
+			for (std::size_t i = 0; i < c_MovementDirections.size(); i++) {
+				directionMasks[i][lane] = MaskIf(direction == static_cast<std::uint32_t>(c_MovementDirections[i]));
+			}
+		}
+
+		// Every lane shifts its bitboards by the same amounts, once per movement direction, and keeps the direction of its piece
+		const auto stepBits = [&directionMasks](std::uint32_t bits, std::size_t lane) {
+			std::uint32_t result = 0;
+			for (std::size_t i = 0; i < c_MovementDirections.size(); i++) {
+				result |= StepBits(bits, c_MovementDirections[i]) & directionMasks[i][lane];
+			}
+			return result;
+		};
+
+		// Find, for every lane, the tiles whose pieces move one step in the direction of the moving piece (the piece itself,
+		// the chain of pieces it pushes or the pushable piece in front of it), and the tiles whose pieces are removed from play.
+		// Every rule of Board::ExecutePieceMove is computed on all lanes, and the lane keeps the one that applies.
+		const std::uint32_t pusherMask = MaskIf(pusher);
+		const std::uint32_t canPushMask = MaskIf(!pushable);
+		alignas(32) LaneArray<std::uint32_t> movedBits;
+		alignas(32) LaneArray<std::uint32_t> removedBits;
+		std::uint32_t anyChange = 0;
+		for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+			const std::uint32_t origin = originBits[lane];
+			const std::uint32_t occupied = occupiedBits[lane];
+
+			const std::uint32_t targetBits = stepBits(origin, lane);
+			const std::uint32_t targetFree = MaskIf((targetBits & occupied) == 0);
+			const std::uint32_t pushTargetBits = stepBits(targetBits, lane);
+			const std::uint32_t canPush = canPushMask & MaskIf((targetBits & (playerOnePushableBits[lane] | playerTwoPushableBits[lane])) != 0)
+				& MaskIf(pushTargetBits != 0) & MaskIf((pushTargetBits & occupied) == 0);
+
+			std::uint32_t chainBits = origin;
+			std::uint32_t nextBits = origin;
+			for (std::size_t distance = 1; distance < c_PlayAreaSize; distance++) {
+				nextBits = stepBits(nextBits, lane) & occupied;
+				chainBits |= nextBits;
+			}
+
+			const std::uint32_t pieceMovedBits = (chainBits & pusherMask)
+				| (((origin & targetFree) | ((origin | targetBits) & canPush & ~targetFree)) & ~pusherMask);
+			const std::uint32_t hasTarget = MaskIf(targetBits != 0);
+			movedBits[lane] = pieceMovedBits & hasTarget;
+			// A piece that can't move from a perimeter tile is removed from play
+			removedBits[lane] = origin & c_PerimeterBits & hasTarget & MaskIf(pieceMovedBits == 0);
+			anyChange |= movedBits[lane] | removedBits[lane];
+		}
+		if (anyChange == 0) {
+			return;
+		}
+
+		for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+			changed[lane] |= static_cast<std::uint8_t>((movedBits[lane] | removedBits[lane]) != 0);
+		}
+		// Moving pieces that leave the board, to the perimeter or outside of the play area, are removed from play
+		for (auto& pieceBits : mPieceBits) {
+			for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+				const std::uint32_t bits = pieceBits[lane];
+				const std::uint32_t moved = MaskIf((bits & movedBits[lane]) != 0);
+				const std::uint32_t removed = MaskIf((bits & removedBits[lane]) != 0);
+				pieceBits[lane] = ((stepBits(bits, lane) & c_BoardBits & moved) | (bits & ~moved)) & ~removed;
+			}
+		}
+	}
+
+	BatchSimulator::LaneArray<std::uint32_t> BatchSimulator::GetPlayerPieceBits(PlayerId playerId) const {
+		const std::size_t firstSlot = playerId == PlayerId::PLAYER_TWO ? c_PieceTypes : 0;
+		alignas(32) LaneArray<std::uint32_t> result{};
+		for (std::size_t slot = firstSlot; slot < firstSlot + c_PieceTypes; slot++) {
+			for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+				result[lane] |= mPieceBits[slot][lane];
+			}
+		}
+		return result;
+	}
+
+	BatchSimulator::LaneArray<std::uint16_t> BatchSimulator::GetLegalPlacementMasks() const {
+		const auto playerOneBits = GetPlayerPieceBits(PlayerId::PLAYER_ONE);
+		const auto playerTwoBits = GetPlayerPieceBits(PlayerId::PLAYER_TWO);
+		alignas(32) LaneArray<std::uint16_t> result{};
+		for (std::size_t i = 0; i < c_PerimeterTileIndices.size(); i++) {
+			const std::uint8_t tile = c_PerimeterTileIndices[i];
+			for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+				const std::uint32_t occupied = (playerOneBits[lane] | playerTwoBits[lane]) >> tile & 1U;
+				result[lane] |= static_cast<std::uint16_t>((occupied ^ 1U) << i);
+			}
+		}
+		return result;
+	}
+
+	BatchSimulator::LaneArray<std::uint8_t> BatchSimulator::GetPiecesInHandMasks(const LaneArray<std::uint8_t>& playerTwo) const {
+		alignas(32) LaneArray<std::uint8_t> result{};
+		for (std::size_t i = 0; i < c_PieceTypes; i++) {
+			const auto& playerOneBits = mPieceBits[i];
+			const auto& playerTwoBits = mPieceBits[i + c_PieceTypes];
+			for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+				const std::uint32_t bits = playerTwo[lane] ? playerTwoBits[lane] : playerOneBits[lane];
+				result[lane] |= static_cast<std::uint8_t>((bits == 0) << i);
+			}
+		}
+		return result;
+	}
+}
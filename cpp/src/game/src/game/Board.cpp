@@ -58,6 +58,8 @@ namespace Alphalcazar::Game {
 		tile->GetPiece().SetMovementDirection(coordinates.GetLegalPlacementDirection());
 
 		SetPlacedPieceCoordinates(piece, coordinates);
+		AddAccumulatedPieceScore(tile->GetPiece(), coordinates);
+		ReplaceAccumulatedPieceFeature(GetPieceHandFeature(piece.GetOwner(), piece.GetType()), GetPieceFeature(piece.GetOwner(), piece.GetType(), coordinates, direction));
 	}
 
 	void Board::PlacePiece(const Coordinates& coordinates, const Piece& piece, Direction direction) {
@@ -71,6 +73,8 @@ namespace Alphalcazar::Game {
 		tile->GetPiece().SetMovementDirection(direction);
 
 		SetPlacedPieceCoordinates(piece, coordinates);
+		AddAccumulatedPieceScore(tile->GetPiece(), coordinates);
+		ReplaceAccumulatedPieceFeature(GetPieceHandFeature(piece.GetOwner(), piece.GetType()), GetPieceFeature(piece.GetOwner(), piece.GetType(), coordinates, direction));
 	}
 
 	BoardMovesCount Board::ExecutePieceMove(const Piece& piece) {
@@ -163,12 +167,18 @@ namespace Alphalcazar::Game {
 	void Board::MovePiece(Tile& source, Tile& target, const Coordinates& targetCoordinates) {
 		if (source.HasPiece()) {
 			const auto& piece = source.GetPiece();
+			const Coordinates sourceCoordinates = GetPlacedPieceCoordinates(piece);
+			SubtractAccumulatedPieceScore(piece, sourceCoordinates);
+			const std::size_t sourceFeature = GetPieceFeature(piece.GetOwner(), piece.GetType(), sourceCoordinates, piece.GetMovementDirection());
 			// A piece that moves or is moved to a perimeter tile gets removed from play immediately
 			if (!targetCoordinates.IsPerimeter()) {
 				SetPlacedPieceCoordinates(piece, targetCoordinates);
 				target.PlacePiece(piece);
+				AddAccumulatedPieceScore(piece, targetCoordinates);
+				ReplaceAccumulatedPieceFeature(sourceFeature, GetPieceFeature(piece.GetOwner(), piece.GetType(), targetCoordinates, piece.GetMovementDirection()));
 			} else {
 				SetPlacedPieceCoordinates(piece, Coordinates::Invalid());
+				ReplaceAccumulatedPieceFeature(sourceFeature, GetPieceHandFeature(piece.GetOwner(), piece.GetType()));
 			}
 			source.RemovePiece();
 		}
@@ -176,6 +186,9 @@ namespace Alphalcazar::Game {
 
 	void Board::RemovePiece(Tile& tile) {
 		if (tile.HasPiece()) {
+			const Piece& piece = tile.GetPiece();
+			SubtractAccumulatedPieceScore(piece, GetPlacedPieceCoordinates(piece));
+			ReplaceAccumulatedPieceFeature(GetPieceFeature(piece.GetOwner(), piece.GetType(), GetPlacedPieceCoordinates(piece), piece.GetMovementDirection()), GetPieceHandFeature(piece.GetOwner(), piece.GetType()));
 			SetPlacedPieceCoordinates(tile.GetPiece(), Coordinates::Invalid());
 			tile.RemovePiece();
 		}
@@ -248,6 +261,19 @@ namespace Alphalcazar::Game {
 		return result;
 	}
 
+	std::uint16_t Board::GetLegalPlacementMask() const {
+		static_assert(c_PerimeterTileCount <= 16, "The perimeter tiles don't fit in the mask");
+		std::uint16_t result = 0;
+		constexpr auto perimeterCoordinates = Coordinates::GetPerimeterCoordinates();
+		for (std::size_t i = 0; i < perimeterCoordinates.size(); i++) {
+			const auto& coordinates = perimeterCoordinates[i];
+			if (!mTiles[coordinates.x][coordinates.y].HasPiece()) {
+				result |= static_cast<std::uint16_t>(1 << i);
+			}
+		}
+		return result;
+	}
+
 	bool Board::IsFull() const {
 		bool result = true;
 		LoopOverTiles([&result](const Coordinates& coordinates, const Tile& tile) {
@@ -391,6 +417,105 @@ namespace Alphalcazar::Game {
 		return result;
 	}
 
+	std::uint16_t Board::GetBoardTileMask(PlayerId player) const {
+		std::uint16_t result = 0;
+		if (player == PlayerId::NONE) {
+			return result;
+		}
+		const auto [min, max] = GetPlacePieceIndexRange(player);
+		for (std::size_t i = min; i <= max; i++) {
+			const auto& coordinates = mPlacedPieceCoordinates[i];
+			if (coordinates.Valid() && !coordinates.IsPerimeter()) {
+				result |= static_cast<std::uint16_t>(1 << GetBoardTileBitIndex(coordinates.x, coordinates.y));
+			}
+		}
+		return result;
+	}
+
+	PositionHash Board::GetHash() const {
+		PositionHash hash = 0;
+		for (std::size_t i = 0; i < mPlacedPieceCoordinates.size(); i++) {
+			const auto& coordinates = mPlacedPieceCoordinates[i];
+			if (coordinates.Valid()) {
+				const Direction direction = mTiles[coordinates.x][coordinates.y].GetPiece().GetMovementDirection();
+				hash ^= c_ZobristKeys.Pieces[GetZobristPieceKeyIndex(i, coordinates, direction)];
+			}
+		}
+		return hash;
+	}
+
+	void Board::SetPieceScoreTable(const PieceScoreTable* table) {
+		mPieceScoreTable = table;
+		mAccumulatedPieceScore = 0;
+		// Accumulate the scores of the pieces that are already in play
+		for (const auto& coordinates : mPlacedPieceCoordinates) {
+			if (coordinates.Valid()) {
+				AddAccumulatedPieceScore(mTiles[coordinates.x][coordinates.y].GetPiece(), coordinates);
+			}
+		}
+	}
+
+	const PieceScoreTable* Board::GetPieceScoreTable() const {
+		return mPieceScoreTable;
+	}
+
+	std::int32_t Board::GetAccumulatedPieceScore() const {
+		return mAccumulatedPieceScore;
+	}
+
+	void Board::AddAccumulatedPieceScore(const Piece& piece, const Coordinates& coordinates) {
+		if (mPieceScoreTable) {
+			const std::int32_t pieceScore = (*mPieceScoreTable)[GetPieceScoreTableIndex(coordinates, piece.GetMovementDirection(), piece.GetType())];
+			mAccumulatedPieceScore += piece.GetOwner() == PlayerId::PLAYER_ONE ? pieceScore : -pieceScore;
+		}
+	}
+
+	void Board::SubtractAccumulatedPieceScore(const Piece& piece, const Coordinates& coordinates) {
+		if (mPieceScoreTable) {
+			const std::int32_t pieceScore = (*mPieceScoreTable)[GetPieceScoreTableIndex(coordinates, piece.GetMovementDirection(), piece.GetType())];
+			mAccumulatedPieceScore -= piece.GetOwner() == PlayerId::PLAYER_ONE ? pieceScore : -pieceScore;
+		}
+	}
+
+	void Board::SetPieceFeatureTable(const PieceFeatureTable* table) {
+		mPieceFeatureTable = table;
+		mAccumulatedPieceFeatures = {};
+		if (!mPieceFeatureTable) {
+			return;
+		}
+		// Accumulate the features of all piece slots, whether their pieces are in play or not
+		for (PlayerId owner : { PlayerId::PLAYER_ONE, PlayerId::PLAYER_TWO }) {
+			for (PieceType pieceType = 1; pieceType <= c_PieceTypes; pieceType++) {
+				const Coordinates& coordinates = GetPlacedPieceCoordinates({ owner, pieceType });
+				const std::size_t feature = coordinates.Valid()
+					? GetPieceFeature(owner, pieceType, coordinates, mTiles[coordinates.x][coordinates.y].GetPiece().GetMovementDirection())
+					: GetPieceHandFeature(owner, pieceType);
+				const PieceFeatureWeights& weights = (*mPieceFeatureTable)[feature];
+				for (std::size_t i = 0; i < c_PieceFeatureWeights; i++) {
+					mAccumulatedPieceFeatures[i] = static_cast<std::int16_t>(mAccumulatedPieceFeatures[i] + weights[i]);
+				}
+			}
+		}
+	}
+
+	const PieceFeatureTable* Board::GetPieceFeatureTable() const {
+		return mPieceFeatureTable;
+	}
+
+	const PieceFeatureWeights& Board::GetAccumulatedPieceFeatures() const {
+		return mAccumulatedPieceFeatures;
+	}
+
+	void Board::ReplaceAccumulatedPieceFeature(std::size_t removedFeature, std::size_t addedFeature) {
+		if (mPieceFeatureTable) {
+			const PieceFeatureWeights& removedWeights = (*mPieceFeatureTable)[removedFeature];
+			const PieceFeatureWeights& addedWeights = (*mPieceFeatureTable)[addedFeature];
+			for (std::size_t i = 0; i < c_PieceFeatureWeights; i++) {
+				mAccumulatedPieceFeatures[i] = static_cast<std::int16_t>(mAccumulatedPieceFeatures[i] - removedWeights[i] + addedWeights[i]);
+			}
+		}
+	}
+
 	void Board::LoopOverTiles(const std::function<bool(const Coordinates& coordinates, const Tile& tile)>& action) const {
 		for (Coordinate x = 0; x <= c_PlayAreaSize - 1; x++) {
 			for (Coordinate y = 0; y <= c_PlayAreaSize - 1; y++) {
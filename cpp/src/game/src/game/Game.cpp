@@ -4,6 +4,7 @@
 #include "game/parameters.hpp"
 #include "game/Strategy.hpp"
 #include "game/Piece.hpp"
+#include "game/zobrist.hpp"
 
 namespace Alphalcazar::Game {
 	Game::Game() = default;
@@ -13,7 +14,10 @@ namespace Alphalcazar::Game {
 	GameResult Game::Play(Strategy& firstPlayerStrategy, Strategy& secondPlayerStrategy) {
 		GameResult result = GameResult::NONE;
 		while (result == GameResult::NONE) {
-			result = PlayTurn(firstPlayerStrategy, secondPlayerStrategy);
+			result = FastForward();
+			if (result == GameResult::NONE) {
+				result = PlayTurn(firstPlayerStrategy, secondPlayerStrategy);
+			}
 		}
 		return result;
 	}
@@ -26,7 +30,9 @@ namespace Alphalcazar::Game {
 	GameResult Game::PlayNextPlacementMove(const PlacementMove& move) {
 		const PlayerId activePlayer = GetActivePlayer();
 		auto result = GameResult::NONE;
-		ExecutePlacementMove(activePlayer, move);
+		if (move.Valid()) {
+			ExecutePlacementMove(activePlayer, move);
+		}
 		if (mState.FirstMoveExecuted) {
 			result = EvaluateTurnEndPhase();
 		} else {
@@ -35,6 +41,35 @@ namespace Alphalcazar::Game {
 		return result;
 	}
 
+	GameResult Game::FastForward() {
+		if (mState.FirstMoveExecuted) {
+			return GameResult::NONE;
+		}
+
+		// Loops are found with Brent's algorithm: every position is compared with a single saved one, which is moved forward
+		// after 1, 2, 4, ... turns, so no history of the positions has to be kept
+		PositionHash savedHash = GetHash();
+		std::size_t turnsSinceSave = 0;
+		std::size_t turnsUntilNextSave = 1;
+		while (!HasLegalMoves(PlayerId::PLAYER_ONE) && !HasLegalMoves(PlayerId::PLAYER_TWO)) {
+			if (const auto result = EvaluateTurnEndPhase(); result != GameResult::NONE) {
+				return result;
+			}
+
+			const PositionHash hash = GetHash();
+			if (hash == savedHash) {
+				// No placement moves will ever be played again, so the game would loop forever
+				return GameResult::DRAW;
+			}
+			if (++turnsSinceSave == turnsUntilNextSave) {
+				savedHash = hash;
+				turnsSinceSave = 0;
+				turnsUntilNextSave *= 2;
+			}
+		}
+		return GameResult::NONE;
+	}
+
 	GameResult Game::EvaluateTurnEndPhase() {
 		const auto executedMoves = mBoard.ExecuteMoves(mState.PlayerWithInitiative);
 		mState.Turn += 1;
@@ -107,6 +142,24 @@ namespace Alphalcazar::Game {
 		return result;
 	}
 
+	bool Game::HasLegalMoves(PlayerId player) const {
+		if (player == PlayerId::NONE || mBoard.GetPiecePlacements(player).all()) {
+			return false;
+		}
+		return !mBoard.GetLegalPlacementCoordinates().empty();
+	}
+
+	PositionHash Game::GetHash() const {
+		PositionHash hash = mBoard.GetHash();
+		if (mState.PlayerWithInitiative == PlayerId::PLAYER_TWO) {
+			hash ^= c_ZobristKeys.PlayerTwoInitiative;
+		}
+		if (mState.FirstMoveExecuted) {
+			hash ^= c_ZobristKeys.FirstMoveExecuted;
+		}
+		return hash;
+	}
+
 	GameResult Game::EvaluateGameResult(BoardMovesCount) const {
 		return mBoard.GetResult();
 	}
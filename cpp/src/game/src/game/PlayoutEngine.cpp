@@ -0,0 +1,75 @@
+#include "game/PlayoutEngine.hpp"
+
+#include "game/Game.hpp"
+#include "game/parameters.hpp"
+
+namespace Alphalcazar::Game {
+	std::uint32_t GetNthSetBitIndex(std::uint32_t mask, std::uint32_t n) {
+		for (std::uint32_t i = 0; i < n; i++) {
+			// Clear the lowest set bit
+			mask &= mask - 1;
+		}
+		std::uint32_t index = 0;
+		while ((mask & 1) == 0) {
+			mask >>= 1;
+			index++;
+		}
+		return index;
+	}
+
+	std::uint32_t GetSetBitCount(std::uint32_t mask) {
+		std::uint32_t count = 0;
+		while (mask != 0) {
+			mask &= mask - 1;
+			count++;
+		}
+		return count;
+	}
+
+	PlayoutEngine::PlayoutEngine(std::uint64_t seed)
+		: mRandomGenerator { seed }
+	{}
+
+	GameResult PlayoutEngine::Play(Game& game, std::size_t maxTurns) {
+		const std::size_t lastTurn = game.GetState().Turn + maxTurns;
+		GameResult result = game.FastForward();
+		while (result == GameResult::NONE) {
+			if (game.GetState().Turn >= lastTurn) {
+				return GameResult::DRAW;
+			}
+			result = PlayMove(game, SampleMove(game));
+		}
+		return result;
+	}
+
+	PlacementMove PlayoutEngine::SampleMove(const Game& game) {
+		const PlayerId playerId = game.GetActivePlayer();
+		const auto& board = game.GetBoard();
+		const std::uint32_t tileMask = board.GetLegalPlacementMask();
+		const std::uint32_t pieceMask = static_cast<std::uint32_t>((~board.GetPiecePlacements(playerId)).to_ulong());
+		const std::uint32_t tileCount = GetSetBitCount(tileMask);
+		const std::uint32_t pieceCount = GetSetBitCount(pieceMask);
+		if (tileCount == 0 || pieceCount == 0) {
+			return {};
+		}
+
+		// Every combination of free tile and piece in hand is a legal move, so we draw one of them
+		const std::uint32_t moveIndex = mRandomGenerator.NextBounded(tileCount * pieceCount);
+		constexpr auto perimeterCoordinates = Coordinates::GetPerimeterCoordinates();
+		const auto& coordinates = perimeterCoordinates[GetNthSetBitIndex(tileMask, moveIndex / pieceCount)];
+		const PieceType pieceType = static_cast<PieceType>(GetNthSetBitIndex(pieceMask, moveIndex % pieceCount) + 1);
+		return { coordinates, pieceType };
+	}
+
+	GameResult PlayoutEngine::PlayMove(Game& game, const PlacementMove& move) {
+		auto result = game.PlayNextPlacementMove(move);
+		if (result == GameResult::NONE && !game.GetState().FirstMoveExecuted) {
+			result = game.FastForward();
+		}
+		return result;
+	}
+
+	Utils::Xoshiro256& PlayoutEngine::GetRandomGenerator() {
+		return mRandomGenerator;
+	}
+}
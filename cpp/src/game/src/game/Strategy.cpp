@@ -0,0 +1,66 @@
+#include "game/Strategy.hpp"
+
+#include "game/Game.hpp"
+
+#include <util/ThreadPool.hpp>
+
+namespace Alphalcazar::Game {
+	StrategyExecution::StrategyExecution(std::shared_ptr<State> state, Utils::ThreadPool& threadPool, const Utils::StopToken& stopToken)
+		: mState { std::move(state) }
+		, mThreadPool { &threadPool }
+		, mStopToken { stopToken }
+	{}
+
+	StrategyExecution::~StrategyExecution() {
+		// Nobody is waiting for the move anymore, so the strategy should not keep searching for it
+		if (mState) {
+			Cancel();
+		}
+	}
+
+	StrategyExecution& StrategyExecution::operator=(StrategyExecution&& other) {
+		if (this != &other) {
+			if (mState) {
+				Cancel();
+			}
+			mState = std::move(other.mState);
+			mThreadPool = other.mThreadPool;
+			mStopToken = other.mStopToken;
+		}
+		return *this;
+	}
+
+	void StrategyExecution::Cancel() {
+		mStopToken.RequestStop();
+	}
+
+	bool StrategyExecution::IsReady() const {
+		return !mState || mState->Done.IsDone();
+	}
+
+	PlacementMove StrategyExecution::Get() {
+		mThreadPool->Wait(mState->Done);
+		const PlacementMove move = mState->Move;
+		mState.reset();
+		return move;
+	}
+
+	const Utils::StopToken& StrategyExecution::GetStopToken() const {
+		return mStopToken;
+	}
+
+	PlacementMove Strategy::ExecuteStoppable(PlayerId playerId, const Utils::StaticVector<PlacementMove, c_MaxLegalMovesCount>& legalMoves, const Game& game, const Utils::StopToken&) {
+		return Execute(playerId, legalMoves, game);
+	}
+
+	StrategyExecution Strategy::ExecuteAsync(PlayerId playerId, const Utils::StaticVector<PlacementMove, c_MaxLegalMovesCount>& legalMoves, const Game& game, Utils::StopToken::Clock::time_point deadline, Utils::ThreadPool* threadPool) {
+		Utils::ThreadPool& pool = threadPool ? *threadPool : Utils::ThreadPool::GetShared();
+		const Utils::StopToken stopToken { deadline };
+		auto state = std::make_shared<StrategyExecution::State>();
+		// The task shares the state, so that it can still write the move once the handle is gone
+		pool.Execute([this, playerId, legalMoves, game, stopToken, state]() {
+			state->Move = ExecuteStoppable(playerId, legalMoves, game, stopToken);
+		}, state->Done);
+		return StrategyExecution { std::move(state), pool, stopToken };
+	}
+}
@@ -5,6 +5,9 @@
 #include "game/Coordinates.hpp"
 #include "game/aliases.hpp"
 
+#include <array>
+#include <vector>
+
 namespace Alphalcazar::Game {
 	static std::array<Piece, 10> c_AllPieces = { {
 		{ PlayerId::PLAYER_ONE, 1 },
@@ -1,4 +1,4 @@
-#include "testhelpers.hpp"
+#include "game/testhelpers.hpp"
 
 namespace Alphalcazar::Game {
 	/// Populates a board's initial position with a list of \ref PieceSetup
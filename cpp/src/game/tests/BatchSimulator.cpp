@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "game/aliases.hpp"
+#include "game/BatchSimulator.hpp"
+#include "game/Board.hpp"
+#include "game/Game.hpp"
+#include "game/PlacementMove.hpp"
+#include "game/PlayoutEngine.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace Alphalcazar::Game {
+	TEST(BatchSimulator, MatchesGame) {
+		for (std::uint64_t seed = 0; seed < 50; seed++) {
+			PlayoutEngine engine{ seed };
+			BatchSimulator simulator;
+			std::array<Game, c_BatchSimulatorLaneCount> games;
+			std::array<GameResult, c_BatchSimulatorLaneCount> results{};
+
+			// Every lane starts from a different position, some of them in the middle of a turn
+			for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+				for (std::size_t i = 0; i < lane % 7 && results[lane] == GameResult::NONE; i++) {
+					results[lane] = games[lane].PlayNextPlacementMove(engine.SampleMove(games[lane]));
+				}
+				simulator.SetGame(lane, games[lane]);
+				EXPECT_EQ(simulator.GetResults()[lane], results[lane]);
+			}
+
+			for (std::size_t round = 0; round < 200 && !simulator.AllFinished(); round++) {
+				const auto moves = simulator.SampleMoves(engine.GetRandomGenerator());
+				for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+					if (results[lane] != GameResult::NONE) {
+						continue;
+					}
+					Game& game = games[lane];
+					const auto legalMoves = game.GetLegalMoves(game.GetActivePlayer());
+					if (moves[lane].Valid()) {
+						EXPECT_NE(std::find(legalMoves.begin(), legalMoves.end(), moves[lane]), legalMoves.end());
+					} else {
+						EXPECT_TRUE(legalMoves.empty());
+					}
+					results[lane] = game.PlayNextPlacementMove(moves[lane]);
+				}
+				simulator.PlayPlacementMoves(moves);
+
+				for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+					const Game& game = games[lane];
+					const GameResult simulatedResult = simulator.GetResults()[lane];
+					if (simulatedResult == GameResult::DRAW && results[lane] == GameResult::NONE) {
+						// The simulator detects positions that will never change again right away, while the game only
+						// detects them when fast-forwarding
+						EXPECT_FALSE(game.HasLegalMoves(PlayerId::PLAYER_ONE));
+						EXPECT_FALSE(game.HasLegalMoves(PlayerId::PLAYER_TWO));
+						results[lane] = GameResult::DRAW;
+						continue;
+					}
+					ASSERT_EQ(simulatedResult, results[lane]);
+					EXPECT_EQ(simulator.GetBoard(lane).GetHash(), game.GetBoard().GetHash());
+					EXPECT_EQ(simulator.GetTurn(lane), game.GetState().Turn);
+					EXPECT_EQ(simulator.GetActivePlayer(lane), game.GetActivePlayer());
+				}
+			}
+		}
+	}
+
+	TEST(BatchSimulator, PlayOut) {
+		constexpr std::size_t maxTurns = 50;
+		for (std::uint64_t seed = 0; seed < 20; seed++) {
+			Utils::Xoshiro256 randomGenerator{ seed };
+			BatchSimulator simulator;
+			const auto results = simulator.PlayOut(randomGenerator, maxTurns);
+			EXPECT_TRUE(simulator.AllFinished());
+			for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+				EXPECT_NE(results[lane], GameResult::NONE);
+				EXPECT_LE(simulator.GetTurn(lane), maxTurns);
+			}
+
+			// Playouts with the same seed are reproducible
+			Utils::Xoshiro256 sameSeedRandomGenerator{ seed };
+			BatchSimulator sameSeedSimulator;
+			EXPECT_EQ(sameSeedSimulator.PlayOut(sameSeedRandomGenerator, maxTurns), results);
+
+			// Finished lanes are not played anymore
+			simulator.PlayPlacementMoves(simulator.SampleMoves(randomGenerator));
+			for (std::size_t lane = 0; lane < c_BatchSimulatorLaneCount; lane++) {
+				EXPECT_EQ(simulator.GetBoard(lane).GetHash(), sameSeedSimulator.GetBoard(lane).GetHash());
+			}
+		}
+	}
+
+	TEST(BatchSimulator, PlayOuts) {
+		// Lanes play more games than there are lanes, and the last batch only partially fills them
+		constexpr std::size_t games = c_BatchSimulatorLaneCount * 3 + 5;
+		Utils::Xoshiro256 randomGenerator{ 0 };
+		BatchSimulator simulator;
+		const auto resultCounts = simulator.PlayOuts(Game{}, games, randomGenerator, 50);
+		EXPECT_EQ(resultCounts[static_cast<std::size_t>(GameResult::NONE)], 0);
+		std::size_t countedGames = 0;
+		for (const std::size_t count : resultCounts) {
+			countedGames += count;
+		}
+		EXPECT_EQ(countedGames, games);
+		EXPECT_GT(resultCounts[static_cast<std::size_t>(GameResult::PLAYER_ONE_WINS)], 0);
+		EXPECT_GT(resultCounts[static_cast<std::size_t>(GameResult::PLAYER_TWO_WINS)], 0);
+
+		// Games that can't play any turn are all draws
+		const auto drawCounts = simulator.PlayOuts(Game{}, games, randomGenerator, 0);
+		EXPECT_EQ(drawCounts[static_cast<std::size_t>(GameResult::DRAW)], games);
+	}
+}
@@ -4,11 +4,15 @@
 #include "game/Board.hpp"
 #include "game/Tile.hpp"
 #include "game/Piece.hpp"
+#include "game/PieceFeatureTable.hpp"
+#include "game/PieceScoreTable.hpp"
+#include "game/PlacementMove.hpp"
 #include "game/parameters.hpp"
 
-#include "testhelpers.hpp"
+#include "game/testhelpers.hpp"
 
 #include <array>
+#include <memory>
 
 namespace Alphalcazar::Game {
 	TEST(Board, SetupTiles) {
@@ -467,4 +471,127 @@ namespace Alphalcazar::Game {
 			EXPECT_TRUE(i == 0 ? playerTwoPlacements[i] : !playerTwoPlacements[i]);
 		}
 	}
+
+	TEST(Board, PositionHash) {
+		const std::vector<PieceSetup> pieceSetups {
+			{ PlayerId::PLAYER_ONE, 1, Direction::NORTH, { 2, 2 } },
+			{ PlayerId::PLAYER_TWO, 3, Direction::WEST, { 3, 1 } },
+		};
+		const Board board = SetupBoardForTesting(pieceSetups);
+		const Board sameBoard = SetupBoardForTesting(pieceSetups);
+
+		// Boards with identical pieces, tiles and directions have the same hash, and an empty board hashes to 0
+		EXPECT_EQ(board.GetHash(), sameBoard.GetHash());
+		EXPECT_EQ(Board{}.GetHash(), 0);
+
+		// Changing the direction, the tile or the owner of a piece changes the hash
+		const Board rotatedBoard = SetupBoardForTesting({
+			{ PlayerId::PLAYER_ONE, 1, Direction::SOUTH, { 2, 2 } },
+			{ PlayerId::PLAYER_TWO, 3, Direction::WEST, { 3, 1 } },
+		});
+		const Board movedBoard = SetupBoardForTesting({
+			{ PlayerId::PLAYER_ONE, 1, Direction::NORTH, { 2, 3 } },
+			{ PlayerId::PLAYER_TWO, 3, Direction::WEST, { 3, 1 } },
+		});
+		const Board swappedOwnersBoard = SetupBoardForTesting({
+			{ PlayerId::PLAYER_TWO, 1, Direction::NORTH, { 2, 2 } },
+			{ PlayerId::PLAYER_ONE, 3, Direction::WEST, { 3, 1 } },
+		});
+		EXPECT_NE(board.GetHash(), rotatedBoard.GetHash());
+		EXPECT_NE(board.GetHash(), movedBoard.GetHash());
+		EXPECT_NE(board.GetHash(), swappedOwnersBoard.GetHash());
+	}
+
+	TEST(Board, AccumulatedPieceScore) {
+		// A table with a different score for every entry, so that any missed update is noticed
+		PieceScoreTable table{};
+		for (std::size_t i = 0; i < table.size(); i++) {
+			table[i] = static_cast<std::int32_t>(i * 7 + 1);
+		}
+		const auto getExpectedScore = [&table](const Board& board) {
+			std::int32_t score = 0;
+			for (const auto& [coordinates, piece] : board.GetPieces()) {
+				const std::int32_t pieceScore = table[GetPieceScoreTableIndex(coordinates, piece.GetMovementDirection(), piece.GetType())];
+				score += piece.GetOwner() == PlayerId::PLAYER_ONE ? pieceScore : -pieceScore;
+			}
+			return score;
+		};
+
+		// Setting the table accounts for the pieces that were already placed
+		Game game = SetupGameForTesting(PlayerId::PLAYER_ONE, false, {
+			{ PlayerId::PLAYER_ONE, 4, Direction::NORTH, { 2, 1 } },
+			{ PlayerId::PLAYER_TWO, 1, Direction::EAST, { 1, 2 } },
+		});
+		EXPECT_EQ(game.GetBoard().GetAccumulatedPieceScore(), 0);
+		game.GetBoard().SetPieceScoreTable(&table);
+		EXPECT_EQ(game.GetBoard().GetPieceScoreTable(), &table);
+		EXPECT_EQ(game.GetBoard().GetAccumulatedPieceScore(), getExpectedScore(game.GetBoard()));
+
+		// Play several turns (with pushes and pieces leaving the board) and check that the accumulator
+		// is kept up to date after every placement move
+		GameResult result = GameResult::NONE;
+		std::size_t moveIndex = 0;
+		while (result == GameResult::NONE && moveIndex < 40) {
+			const auto legalMoves = game.GetLegalMoves(game.GetActivePlayer());
+			const PlacementMove move = legalMoves.empty() ? PlacementMove{} : legalMoves[(moveIndex * 5) % legalMoves.size()];
+			result = game.PlayNextPlacementMove(move);
+			EXPECT_EQ(game.GetBoard().GetAccumulatedPieceScore(), getExpectedScore(game.GetBoard()));
+			moveIndex++;
+		}
+
+		// Copies of the board keep accumulating with the same table
+		const Board boardCopy = game.GetBoard();
+		EXPECT_EQ(boardCopy.GetPieceScoreTable(), &table);
+		EXPECT_EQ(boardCopy.GetAccumulatedPieceScore(), game.GetBoard().GetAccumulatedPieceScore());
+	}
+
+	TEST(Board, AccumulatedPieceFeatures) {
+		// A table with different weights for every feature, so that any missed update is noticed
+		auto table = std::make_unique<PieceFeatureTable>();
+		for (std::size_t feature = 0; feature < table->size(); feature++) {
+			for (std::size_t i = 0; i < c_PieceFeatureWeights; i++) {
+				(*table)[feature][i] = static_cast<std::int16_t>((feature * 31 + i * 7) % 201 - 100);
+			}
+		}
+		const auto getExpectedFeatures = [&table](const Board& board) {
+			PieceFeatureWeights features{};
+			for (const Piece& piece : c_AllPieces) {
+				std::size_t feature = GetPieceHandFeature(piece.GetOwner(), piece.GetType());
+				for (const auto& [coordinates, boardPiece] : board.GetPieces()) {
+					if (boardPiece == piece) {
+						feature = GetPieceFeature(piece.GetOwner(), piece.GetType(), coordinates, boardPiece.GetMovementDirection());
+					}
+				}
+				for (std::size_t i = 0; i < c_PieceFeatureWeights; i++) {
+					features[i] = static_cast<std::int16_t>(features[i] + (*table)[feature][i]);
+				}
+			}
+			return features;
+		};
+
+		// Setting the table accounts for the pieces that were already placed, and the ones in hand
+		Game game = SetupGameForTesting(PlayerId::PLAYER_ONE, false, {
+			{ PlayerId::PLAYER_ONE, 4, Direction::NORTH, { 2, 1 } },
+			{ PlayerId::PLAYER_TWO, 1, Direction::EAST, { 1, 2 } },
+		});
+		game.GetBoard().SetPieceFeatureTable(table.get());
+		EXPECT_EQ(game.GetBoard().GetPieceFeatureTable(), table.get());
+		EXPECT_EQ(game.GetBoard().GetAccumulatedPieceFeatures(), getExpectedFeatures(game.GetBoard()));
+
+		// Play several turns (with pushes and pieces leaving the board) and check that the accumulator
+		// is kept up to date after every placement move
+		GameResult result = GameResult::NONE;
+		std::size_t moveIndex = 0;
+		while (result == GameResult::NONE && moveIndex < 40) {
+			const auto legalMoves = game.GetLegalMoves(game.GetActivePlayer());
+			const PlacementMove move = legalMoves.empty() ? PlacementMove{} : legalMoves[(moveIndex * 5) % legalMoves.size()];
+			result = game.PlayNextPlacementMove(move);
+			EXPECT_EQ(game.GetBoard().GetAccumulatedPieceFeatures(), getExpectedFeatures(game.GetBoard()));
+			moveIndex++;
+		}
+
+		// Disabling the accumulation clears the accumulated weights
+		game.GetBoard().SetPieceFeatureTable(nullptr);
+		EXPECT_EQ(game.GetBoard().GetAccumulatedPieceFeatures(), PieceFeatureWeights{});
+	}
 }
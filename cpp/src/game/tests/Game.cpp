@@ -8,7 +8,12 @@
 #include "game/PlacementMove.hpp"
 #include "game/parameters.hpp"
 
+#include "game/testhelpers.hpp"
+
+#include <util/ThreadPool.hpp>
+
 #include <algorithm>
+#include <thread>
 
 namespace Alphalcazar::Game {
 	class MockStrategy final : public Strategy {
@@ -21,6 +26,21 @@ namespace Alphalcazar::Game {
 		}
 	};
 
+	/// Keeps searching until it is stopped
+	class StoppableMockStrategy final : public Strategy {
+	public:
+		PlacementMove Execute(PlayerId, const Utils::StaticVector<PlacementMove, c_MaxLegalMovesCount>& legalMoves, const Game&) override {
+			return legalMoves[0];
+		}
+
+		PlacementMove ExecuteStoppable(PlayerId, const Utils::StaticVector<PlacementMove, c_MaxLegalMovesCount>& legalMoves, const Game&, const Utils::StopToken& stopToken) override {
+			while (!stopToken.CheckDeadline()) {
+				std::this_thread::yield();
+			}
+			return legalMoves[0];
+		}
+	};
+
 	TEST(Game, InitialGameState) {
 		const Game game{};
 
@@ -144,4 +164,113 @@ namespace Alphalcazar::Game {
 		EXPECT_NE(pieceTwoBoardIter, boardPieces.end());
 		EXPECT_TRUE(pieceTwoBoardIter->first.x == 1 && pieceTwoBoardIter->first.y == 3);
 	}
+
+	TEST(Game, ExecuteStrategyAsync) {
+		const Game game{};
+		MockStrategy strategy;
+		const auto legalMoves = game.GetLegalMoves(PlayerId::PLAYER_ONE);
+
+		// Strategies that don't support stopping return their move from the background thread as usual
+		auto execution = strategy.ExecuteAsync(PlayerId::PLAYER_ONE, legalMoves, game);
+		EXPECT_FALSE(execution.GetStopToken().HasDeadline());
+		EXPECT_EQ(execution.Get(), (PlacementMove{ { 0, 2 }, 3 }));
+
+		// Even when they are cancelled right away
+		auto cancelledExecution = strategy.ExecuteAsync(PlayerId::PLAYER_TWO, legalMoves, game);
+		cancelledExecution.Cancel();
+		EXPECT_TRUE(cancelledExecution.GetStopToken().StopRequested());
+		EXPECT_EQ(cancelledExecution.Get(), (PlacementMove{ { 0, 3 }, 2 }));
+	}
+
+	TEST(Game, DropStrategyExecution) {
+		const Game game{};
+		StoppableMockStrategy strategy;
+		StoppableMockStrategy otherStrategy;
+		const auto legalMoves = game.GetLegalMoves(PlayerId::PLAYER_ONE);
+		Utils::ThreadPool threadPool { 1 };
+
+		// Dropping the handle stops the strategy without waiting for it, even if it would never return on its own
+		auto execution = strategy.ExecuteAsync(PlayerId::PLAYER_ONE, legalMoves, game, Utils::StopToken::Clock::time_point::max(), &threadPool);
+		const Utils::StopToken stopToken = execution.GetStopToken();
+		execution = otherStrategy.ExecuteAsync(PlayerId::PLAYER_ONE, legalMoves, game, Utils::StopToken::Clock::time_point::max(), &threadPool);
+		EXPECT_TRUE(stopToken.StopRequested());
+
+		// The move can still be retrieved from the handle replacing it, which runs the queued strategy itself if needed
+		execution.Cancel();
+		EXPECT_EQ(execution.Get(), legalMoves[0]);
+		EXPECT_TRUE(execution.IsReady());
+	}
+
+	TEST(Game, PositionHash) {
+		Game game{};
+		const PositionHash initialHash = game.GetHash();
+
+		// Executing the first placement move of a turn changes the hash
+		game.PlayNextPlacementMove({ { 0, 2 }, 3 });
+		EXPECT_NE(game.GetHash(), initialHash);
+
+		// The same board with a different player to move hashes differently
+		Game otherInitiativeGame = game;
+		otherInitiativeGame.GetState().PlayerWithInitiative = PlayerId::PLAYER_TWO;
+		EXPECT_NE(game.GetHash(), otherInitiativeGame.GetHash());
+
+		// The turn number is not part of the hash
+		Game laterTurnGame = game;
+		laterTurnGame.GetState().Turn += 2;
+		EXPECT_EQ(game.GetHash(), laterTurnGame.GetHash());
+	}
+
+	TEST(Game, FastForwardWithPiecesInHand) {
+		Game game{};
+		// Both players have pieces in hand, so there is nothing to fast-forward
+		EXPECT_EQ(game.FastForward(), GameResult::NONE);
+		EXPECT_EQ(game.GetState().Turn, 0);
+	}
+
+	TEST(Game, FastForwardWithEmptyHands) {
+		/*
+		 * All 10 pieces are in play (9 filling the board and player two's pusher on the perimeter),
+		 * so neither player can place a piece and the next turn is fully deterministic.
+		 * The pushers will push pieces out of the board, giving the players placement moves again.
+		 */
+		const std::vector<PieceSetup> pieceSetups {
+			{ PlayerId::PLAYER_ONE, 1, Direction::NORTH, { 1, 1 } },
+			{ PlayerId::PLAYER_ONE, 2, Direction::NORTH, { 1, 2 } },
+			{ PlayerId::PLAYER_ONE, 3, Direction::NORTH, { 1, 3 } },
+			{ PlayerId::PLAYER_ONE, 4, Direction::SOUTH, { 2, 2 } },
+			{ PlayerId::PLAYER_ONE, 5, Direction::EAST, { 3, 3 } },
+			{ PlayerId::PLAYER_TWO, 1, Direction::SOUTH, { 2, 1 } },
+			{ PlayerId::PLAYER_TWO, 2, Direction::SOUTH, { 2, 3 } },
+			{ PlayerId::PLAYER_TWO, 3, Direction::WEST, { 3, 1 } },
+			{ PlayerId::PLAYER_TWO, 5, Direction::WEST, { 3, 2 } },
+			{ PlayerId::PLAYER_TWO, 4, Direction::WEST, { 4, 2 } },
+		};
+		Game game = SetupGameForTesting(PlayerId::PLAYER_ONE, false, pieceSetups);
+		EXPECT_FALSE(game.HasLegalMoves(PlayerId::PLAYER_ONE));
+		EXPECT_FALSE(game.HasLegalMoves(PlayerId::PLAYER_TWO));
+
+		Game expectedGame = game;
+		const BoardMovesCount expectedMoves = expectedGame.GetBoard().ExecuteMoves(PlayerId::PLAYER_ONE);
+		EXPECT_GT(expectedMoves, 0);
+
+		// The turn should have been played out exactly like the end of a regular turn
+		const GameResult result = game.FastForward();
+		EXPECT_EQ(result, expectedGame.GetBoard().GetResult());
+		EXPECT_EQ(game.GetState().Turn, 1);
+		EXPECT_EQ(game.GetState().PlayerWithInitiative, PlayerId::PLAYER_TWO);
+		EXPECT_EQ(game.GetBoard().GetHash(), expectedGame.GetBoard().GetHash());
+		EXPECT_TRUE(game.HasLegalMoves(PlayerId::PLAYER_ONE) || game.HasLegalMoves(PlayerId::PLAYER_TWO));
+	}
+
+	TEST(Game, PassingPlacementMove) {
+		Game game{};
+		// An invalid placement move is a pass, which still advances the turn
+		game.PlayNextPlacementMove({});
+		EXPECT_EQ(game.GetState().FirstMoveExecuted, true);
+		EXPECT_EQ(game.GetBoard().GetPieces().size(), 0);
+
+		game.PlayNextPlacementMove({ { 0, 2 }, 3 });
+		EXPECT_EQ(game.GetState().Turn, 1);
+		EXPECT_EQ(game.GetBoard().GetPieces().size(), 1);
+	}
 }
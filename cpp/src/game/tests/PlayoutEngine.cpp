@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include "game/aliases.hpp"
+#include "game/Board.hpp"
+#include "game/Game.hpp"
+#include "game/Piece.hpp"
+#include "game/PlacementMove.hpp"
+#include "game/PlayoutEngine.hpp"
+#include "game/Tile.hpp"
+#include "game/board_utils.hpp"
+#include "game/parameters.hpp"
+
+#include "game/testhelpers.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace Alphalcazar::Game {
+	/// Checks the invariants of the rules engine that must hold at any point of a game
+	void ExpectValidGameState(const Game& game) {
+		const Board& board = game.GetBoard();
+		for (auto playerId : { PlayerId::PLAYER_ONE, PlayerId::PLAYER_TWO }) {
+			// Every piece is either in play or in hand
+			EXPECT_EQ(board.GetPieces(playerId).size() + game.GetPiecesInHand(playerId).size(), c_PieceTypes);
+		}
+		for (const auto& [coordinates, piece] : board.GetPieces()) {
+			// The tile of every piece in play holds that very piece
+			const Tile* tile = board.GetTile(coordinates);
+			ASSERT_NE(tile, nullptr);
+			ASSERT_TRUE(tile->HasPiece());
+			EXPECT_EQ(tile->GetPiece().GetOwner(), piece.GetOwner());
+			EXPECT_EQ(tile->GetPiece().GetType(), piece.GetType());
+			// Pieces on the perimeter are removed at the end of each turn
+			if (!game.GetState().FirstMoveExecuted) {
+				EXPECT_FALSE(coordinates.IsPerimeter());
+			}
+		}
+		// The win conditions checked with the board tile masks match the ones checked on the tiles
+		EXPECT_EQ(GetRowMaskResult(board.GetBoardTileMask(PlayerId::PLAYER_ONE), board.GetBoardTileMask(PlayerId::PLAYER_TWO)), board.GetResult());
+	}
+
+	TEST(PlayoutEngine, SampleMove) {
+		PlayoutEngine engine{ 1 };
+		Game game = SetupGameForTesting(PlayerId::PLAYER_ONE, false, {
+			{ PlayerId::PLAYER_ONE, 2, Direction::NORTH, { 1, 0 } },
+			{ PlayerId::PLAYER_ONE, 4, Direction::EAST, { 2, 2 } },
+			{ PlayerId::PLAYER_TWO, 1, Direction::WEST, { 4, 3 } },
+		});
+		const auto legalMoves = game.GetLegalMoves(PlayerId::PLAYER_ONE);
+
+		// Sampled moves are always legal, and every legal move can be sampled
+		std::array<bool, c_MaxLegalMovesCount> sampled{};
+		for (std::size_t i = 0; i < legalMoves.size() * 100; i++) {
+			const PlacementMove move = engine.SampleMove(game);
+			const auto legalMove = std::find(legalMoves.begin(), legalMoves.end(), move);
+			ASSERT_NE(legalMove, legalMoves.end());
+			sampled[static_cast<std::size_t>(legalMove - legalMoves.begin())] = true;
+		}
+		EXPECT_EQ(static_cast<std::size_t>(std::count(sampled.begin(), sampled.end(), true)), legalMoves.size());
+
+		// A player without pieces in hand passes
+		Game fullHandGame = SetupGameForTesting(PlayerId::PLAYER_TWO, false, {
+			{ PlayerId::PLAYER_TWO, 1, Direction::NORTH, { 1, 1 } },
+			{ PlayerId::PLAYER_TWO, 2, Direction::NORTH, { 1, 2 } },
+			{ PlayerId::PLAYER_TWO, 3, Direction::EAST, { 2, 1 } },
+			{ PlayerId::PLAYER_TWO, 4, Direction::SOUTH, { 3, 3 } },
+			{ PlayerId::PLAYER_TWO, 5, Direction::WEST, { 3, 1 } },
+		});
+		EXPECT_FALSE(engine.SampleMove(fullHandGame).Valid());
+	}
+
+	TEST(PlayoutEngine, Reproducible) {
+		for (std::uint64_t seed = 0; seed < 20; seed++) {
+			Game game{};
+			Game sameSeedGame{};
+			PlayoutEngine engine{ seed };
+			PlayoutEngine sameSeedEngine{ seed };
+			EXPECT_EQ(engine.Play(game, 1000), sameSeedEngine.Play(sameSeedGame, 1000));
+			EXPECT_EQ(game.GetHash(), sameSeedGame.GetHash());
+			EXPECT_EQ(game.GetState().Turn, sameSeedGame.GetState().Turn);
+		}
+	}
+
+	TEST(PlayoutEngine, MaxTurns) {
+		Game game{};
+		PlayoutEngine engine{ 3 };
+		// Games can't be won before every player has been able to complete a row
+		EXPECT_EQ(engine.Play(game, 1), GameResult::DRAW);
+		EXPECT_EQ(game.GetState().Turn, 1);
+	}
+
+	TEST(PlayoutEngine, FuzzRules) {
+		// Plays out many random games move by move, checking the rules engine invariants after every placement
+		PlayoutEngine engine{ 2024 };
+		std::array<std::size_t, 4> resultCounts{};
+		for (std::size_t playout = 0; playout < 10000; playout++) {
+			Game game{};
+			GameResult result = GameResult::NONE;
+			while (result == GameResult::NONE && game.GetState().Turn < 1000) {
+				const PlacementMove move = engine.SampleMove(game);
+				EXPECT_EQ(move.Valid(), game.HasLegalMoves(game.GetActivePlayer()));
+				result = PlayoutEngine::PlayMove(game, move);
+				ExpectValidGameState(game);
+			}
+			ASSERT_NE(result, GameResult::NONE);
+			resultCounts[static_cast<std::size_t>(result)]++;
+		}
+		// Random games should be won by both players
+		EXPECT_GT(resultCounts[static_cast<std::size_t>(GameResult::PLAYER_ONE_WINS)], 0);
+		EXPECT_GT(resultCounts[static_cast<std::size_t>(GameResult::PLAYER_TWO_WINS)], 0);
+	}
+}
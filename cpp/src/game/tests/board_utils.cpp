@@ -11,4 +11,23 @@ namespace Alphalcazar::Game {
 			EXPECT_EQ(distance, c_BoardSize);
 		}
 	}
+
+	TEST(BoardUtils, RowMasks) {
+		constexpr auto rowMasks = GetAllRowMasks();
+		for (const std::uint16_t rowMask : rowMasks) {
+			std::size_t tileCount = 0;
+			for (std::uint16_t mask = rowMask; mask != 0; mask &= mask - 1) {
+				tileCount++;
+			}
+			EXPECT_EQ(tileCount, c_BoardSize);
+		}
+
+		// Center column of player one, and a diagonal of player two
+		const std::uint16_t centerColumn = rowMasks[c_CenterCoordinate - 1];
+		const std::uint16_t diagonal = rowMasks[c_BoardSize * 2];
+		EXPECT_EQ(GetRowMaskResult(centerColumn, 0), GameResult::PLAYER_ONE_WINS);
+		EXPECT_EQ(GetRowMaskResult(0, diagonal), GameResult::PLAYER_TWO_WINS);
+		EXPECT_EQ(GetRowMaskResult(centerColumn & ~diagonal, diagonal & ~centerColumn), GameResult::NONE);
+		EXPECT_EQ(GetRowMaskResult(rowMasks[0], rowMasks[c_BoardSize - 1]), c_AcceptDraws ? GameResult::DRAW : GameResult::NONE);
+	}
 }
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "mcts/Node.hpp"
+#include "mcts/NodeArena.hpp"
+
+#include <game/Strategy.hpp>
+#include <game/aliases.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace Alphalcazar::Game {
+	struct PlacementMove;
+	class Game;
+	class PlayoutEngine;
+}
+
+namespace Alphalcazar::Utils {
+	class ThreadPool;
+}
+
+namespace Alphalcazar::Strategy::MCTS {
+	/*!
+	 * \brief A strategy that determines the move to play with a Monte Carlo tree search.
+	 *
+	 * Each search iteration walks down the search tree choosing moves with the PUCT formula (using the move heuristics
+	 * of the min-max strategy as priors), expands the reached node and scores it by playing out the rest of the game
+	 * with random moves. The move that was searched the most is played.
+	 *
+	 * Unlike a fixed-depth search, the search can be stopped at any time, so its strength scales with the available
+	 * time and cores. When multithreaded, all threads search the same tree, using virtual losses to spread out over
+	 * different branches.
+	 */
+	class MCTSStrategy final : public Game::Strategy {
+	public:
+		/*!
+		 * \param maxIterations The maximum amount of search iterations per move, or 0 for no limit.
+		 * \param maxTime The maximum time to search per move, or 0 for no limit. At least one of the limits must be set.
+		 * \param multithreaded Whether the search will be run on multiple threads.
+		 * \param maxThreads The max amount of threads searching at once when multithreaded, counting the thread calling \ref Execute,
+		 *                   or 0 for as many as the thread pool has, plus that thread.
+		 * \param threadPool The thread pool that runs the search when multithreaded, or nullptr to use the one shared by the whole
+		 *                   process (see \ref Utils::ThreadPool::GetShared). The pool must outlive the strategy.
+		 */
+		MCTSStrategy(std::size_t maxIterations, std::chrono::milliseconds maxTime, bool multithreaded = true, std::size_t maxThreads = 0, Utils::ThreadPool* threadPool = nullptr);
+		~MCTSStrategy() override;
+
+		Game::PlacementMove Execute(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game) override;
+
+		/// Returns the amount of search iterations run by the last \ref Execute function call
+		std::size_t GetLastIterationCount() const;
+	private:
+		/// Runs search iterations on the tree until the search budget is exhausted
+		void RunSearch(const Game::Game& rootGame, std::uint64_t seed);
+
+		/*!
+		 * \brief Runs a single search iteration: walks down the tree from the root, expands the reached node,
+		 *        plays out the rest of the game and updates the statistics of the visited nodes with its result.
+		 *
+		 * \param path Storage for the visited nodes, reused across iterations to avoid allocations.
+		 */
+		void RunIteration(const Game::Game& rootGame, Game::PlayoutEngine& playoutEngine, std::vector<Node*>& path);
+
+		/*!
+		 * \brief Creates the children of a node below the root, one for each legal move of the active player of the specified game.
+		 *
+		 * \returns Whether the node was expanded. Fails if another thread is already expanding it or if the tree is full.
+		 */
+		bool Expand(Node& node, const Game::Game& game);
+
+		/*!
+		 * \brief Creates the children of a node, one for each of the specified legal moves of the player (which are sorted and
+		 *        filtered as for the min-max search), or a single pass if there are none.
+		 *
+		 * Used directly for the root, whose legal moves are the ones the caller of \ref Execute allows.
+		 *
+		 * \returns Whether the node was expanded. Fails if another thread is already expanding it or if the tree is full.
+		 */
+		bool Expand(Node& node, Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game);
+
+		/// Returns the child of an expanded node with the highest PUCT score
+		Node& SelectChild(Node& node) const;
+
+		/// Reserves a new search iteration. Returns false if the iteration or time limit of the current search has been reached.
+		bool TryStartIteration();
+
+		/// The thread pool that will run the search if mMultithreaded is true
+		Utils::ThreadPool* mThreadPool = nullptr;
+		/// The amount of threads searching at once, counting the thread calling \ref Execute
+		std::size_t mThreadCount = 1;
+		/// The pool from which the search tree nodes are allocated
+		NodeArena mArena;
+		/// The root of the search tree, representing the position the strategy is executed on
+		Node mRoot;
+		/// The amount of search iterations started by the current search
+		std::atomic<std::size_t> mStartedIterations = 0;
+		/// The time at which the current search must stop
+		std::chrono::steady_clock::time_point mDeadline;
+		/// Used to seed the playout engines of the search threads
+		std::random_device mRandomDevice;
+
+		/// The amount of search iterations run by the last \ref Execute function call
+		std::size_t mLastIterationCount = 0;
+		/// The maximum amount of search iterations per move, or 0 for no limit
+		std::size_t mMaxIterations;
+		/// The maximum time to search per move, or 0 for no limit
+		std::chrono::milliseconds mMaxTime;
+		/// Whether the search will be run on multiple threads
+		bool mMultithreaded;
+	};
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <game/aliases.hpp>
+#include <game/PlacementMove.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace Alphalcazar::Strategy::MCTS {
+	/// The expansion state of a \ref Node
+	enum class ExpansionState : std::uint8_t {
+		/// The children of the node have not been created yet
+		UNEXPANDED = 0,
+		/// A search thread is creating the children of the node
+		EXPANDING,
+		/// The children of the node have been created and can be visited
+		EXPANDED,
+	};
+
+	/*!
+	 * \brief A node of the search tree, representing the position reached after playing a move.
+	 *
+	 * Nodes are shared by all search threads, so their statistics are atomic. The children of a node are
+	 * allocated contiguously by the \ref NodeArena and are published by setting the expansion state
+	 * to \ref ExpansionState::EXPANDED, after which they are never modified (apart from their statistics).
+	 */
+	struct Node {
+		/// Prepares a node (possibly reused from a previous search) to represent the specified move
+		void Reset(const Game::PlacementMove& move, Game::PlayerId player, float prior);
+
+		/*!
+		 * \brief Returns the average reward of the node from the perspective of \ref Player, from 0 (loss) to 1 (win).
+		 *
+		 * Pending virtual losses count as visits without reward, so threads that are currently searching through
+		 * the node make it look worse to the other threads.
+		 */
+		float GetValue() const;
+
+		/// The move that leads to this node from its parent. Invalid if the player has no legal moves and passes.
+		Game::PlacementMove Move;
+		/// The player that plays \ref Move. The rewards of the node are from their perspective.
+		Game::PlayerId Player = Game::PlayerId::NONE;
+		/// The prior probability of \ref Move being the best move among its siblings
+		float Prior = 0.f;
+
+		/// The amount of completed search iterations that went through this node
+		std::atomic<std::uint32_t> Visits = 0;
+		/// The amount of search iterations that are currently going through this node (see \ref GetValue)
+		std::atomic<std::uint32_t> VirtualLosses = 0;
+		/// The sum of the rewards of all completed iterations: 2 for a win, 1 for a draw and 0 for a loss
+		std::atomic<std::uint32_t> TotalReward = 0;
+
+		std::atomic<ExpansionState> State = ExpansionState::UNEXPANDED;
+		/// The first child of the node. Only valid once the node is expanded.
+		Node* Children = nullptr;
+		/// The amount of children of the node. Only valid once the node is expanded.
+		std::uint8_t ChildCount = 0;
+	};
+}
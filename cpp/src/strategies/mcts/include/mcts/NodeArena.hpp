@@ -0,0 +1,52 @@
+#pragma once
+
+#include "mcts/Node.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Alphalcazar::Strategy::MCTS {
+	/*!
+	 * \brief A pool of search tree nodes, allocated in large blocks.
+	 *
+	 * Nodes are never freed individually: the whole arena is cleared at once with \ref Reset once the search
+	 * tree is no longer needed. The allocated blocks are kept, so that subsequent searches don't allocate any memory
+	 * until they grow past the size of the previous trees.
+	 */
+	class NodeArena {
+	public:
+		/// Creates an arena that will hold at most the specified amount of nodes
+		NodeArena(std::size_t maxNodeCount);
+
+		NodeArena(const NodeArena&) = delete;
+		NodeArena& operator=(const NodeArena&) = delete;
+
+		/*!
+		 * \brief Allocates the specified amount of contiguous nodes. Thread-safe.
+		 *
+		 * \returns A pointer to the first allocated node, or nullptr if the arena is full.
+		 *          The nodes must be initialized with \ref Node::Reset before being used.
+		 */
+		Node* Allocate(std::size_t count);
+
+		/// Makes all nodes available for allocation again. Must not be called while other threads use the arena.
+		void Reset();
+
+		/// Returns the amount of nodes allocated since the last \ref Reset
+		std::size_t GetAllocatedNodeCount() const;
+	private:
+		/// The blocks of nodes owned by the arena, each holding \ref c_NodeArenaBlockSize nodes
+		std::vector<std::unique_ptr<Node[]>> mBlocks;
+		/// The index of the block from which nodes are currently being allocated
+		std::size_t mCurrentBlock = 0;
+		/// The index of the next free node of the current block
+		std::size_t mCurrentBlockOffset = 0;
+		/// The amount of nodes allocated since the last \ref Reset
+		std::size_t mAllocatedNodeCount = 0;
+		/// The maximum amount of nodes the arena can hold
+		std::size_t mMaxNodeCount;
+		/// A mutex to safely allocate nodes from several threads
+		mutable std::mutex mMutex;
+	};
+}
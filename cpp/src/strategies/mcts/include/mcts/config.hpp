@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Alphalcazar::Strategy::MCTS {
+	/*!
+	 * \brief The exploration constant of the PUCT selection formula.
+	 *
+	 * Higher values make the search explore moves with few visits (weighted by their prior) more often,
+	 * lower values make it focus on the moves that have performed best so far.
+	 */
+	constexpr float c_ExplorationConstant = 1.5f;
+
+	/*!
+	 * \brief The temperature of the softmax that turns the heuristic scores of the legal moves into priors.
+	 *
+	 * The heuristic move scores are in the order of hundreds, so a temperature in the same order keeps
+	 * the priors from collapsing onto the single best scored move.
+	 */
+	constexpr float c_PriorTemperature = 100.f;
+
+	/*!
+	 * \brief The value assumed for a move that has not been visited yet, from 0 (loss) to 1 (win).
+	 *
+	 * Equal to a draw, so that unvisited moves are neither preferred nor avoided over visited ones with an even record.
+	 */
+	constexpr float c_UnvisitedNodeValue = 0.5f;
+
+	/// The amount of nodes allocated at once by the \ref NodeArena
+	constexpr std::size_t c_NodeArenaBlockSize = 1 << 14;
+
+	/// The maximum amount of nodes of a search tree. Once reached, the tree stops growing and leaves are only played out.
+	constexpr std::size_t c_MaxNodeCount = 1 << 20;
+
+	/// The maximum amount of turns a playout can last before it is scored as a draw
+	constexpr std::size_t c_MaxPlayoutTurns = 100;
+}
@@ -0,0 +1,212 @@
+#include "mcts/MCTSStrategy.hpp"
+
+#include "mcts/config.hpp"
+
+#include <game/Game.hpp>
+#include <game/PlacementMove.hpp>
+#include <game/PlayoutEngine.hpp>
+#include <minmax/LegalMovements.hpp>
+#include <util/Log.hpp>
+#include "util/ThreadPool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace Alphalcazar::Strategy::MCTS {
+	/// Returns the reward of a game result for the specified player: 2 for a win, 1 for a draw and 0 for a loss
+	std::uint32_t GetReward(Game::PlayerId playerId, Game::GameResult result) {
+		switch (result) {
+		case Game::GameResult::PLAYER_ONE_WINS:
+			return playerId == Game::PlayerId::PLAYER_ONE ? 2 : 0;
+		case Game::GameResult::PLAYER_TWO_WINS:
+			return playerId == Game::PlayerId::PLAYER_TWO ? 2 : 0;
+		default:
+			return 1;
+		}
+	}
+
+	MCTSStrategy::MCTSStrategy(std::size_t maxIterations, std::chrono::milliseconds maxTime, bool multithreaded, std::size_t maxThreads, Utils::ThreadPool* threadPool)
+		: mArena { c_MaxNodeCount }
+		, mMaxIterations { maxIterations }
+		, mMaxTime { maxTime }
+		, mMultithreaded { multithreaded }
+	{
+		assert(mMaxIterations > 0 || mMaxTime.count() > 0);
+		if (mMultithreaded) {
+			// The thread calling Execute also searches, on top of the worker threads
+			mThreadPool = threadPool ? threadPool : &Utils::ThreadPool::GetShared();
+			mThreadCount = maxThreads > 0 ? maxThreads : mThreadPool->GetThreadCount() + 1;
+		}
+	}
+
+	MCTSStrategy::~MCTSStrategy() = default;
+
+	Game::PlacementMove MCTSStrategy::Execute(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game) {
+		assert(!legalMoves.empty());
+		const auto opponentId = playerId == Game::PlayerId::PLAYER_ONE ? Game::PlayerId::PLAYER_TWO : Game::PlayerId::PLAYER_ONE;
+
+		// The tree of the previous search is discarded, and its nodes reused
+		mArena.Reset();
+		mRoot.Reset({}, opponentId, 1.f);
+		mStartedIterations = 0;
+		mDeadline = std::chrono::steady_clock::now() + mMaxTime;
+		if (!Expand(mRoot, playerId, legalMoves, game)) {
+			Utils::LogError("Could not expand the root of the search tree");
+			return legalMoves[0];
+		}
+
+		const std::uint64_t seed = (static_cast<std::uint64_t>(mRandomDevice()) << 32) | mRandomDevice();
+		if (mMultithreaded) {
+			mThreadPool->ParallelFor(0, mThreadCount, [this, &game, seed](std::size_t i) {
+				RunSearch(game, seed + i);
+			});
+		} else {
+			RunSearch(game, seed);
+		}
+
+		// The most visited move is the most reliable one, as its value is based on the most playouts
+		const Node* bestChild = &mRoot.Children[0];
+		for (std::size_t i = 1; i < mRoot.ChildCount; i++) {
+			const Node& child = mRoot.Children[i];
+			if (child.Visits > bestChild->Visits || (child.Visits == bestChild->Visits && child.GetValue() > bestChild->GetValue())) {
+				bestChild = &child;
+			}
+		}
+
+		mLastIterationCount = mRoot.Visits;
+		Utils::LogDebug("Player {} played {} with {}/{} visits and value {} ({} nodes).", static_cast<std::size_t>(playerId), bestChild->Move, bestChild->Visits.load(), mLastIterationCount, bestChild->GetValue(), mArena.GetAllocatedNodeCount());
+		return bestChild->Move;
+	}
+
+	void MCTSStrategy::RunSearch(const Game::Game& rootGame, std::uint64_t seed) {
+		Game::PlayoutEngine playoutEngine{ seed };
+		std::vector<Node*> path;
+		while (TryStartIteration()) {
+			RunIteration(rootGame, playoutEngine, path);
+		}
+	}
+
+	void MCTSStrategy::RunIteration(const Game::Game& rootGame, Game::PlayoutEngine& playoutEngine, std::vector<Node*>& path) {
+		Game::Game game = rootGame;
+		path.clear();
+
+		// Selection: walk down the tree until a node that is not expanded yet is reached, and expand it
+		Node* node = &mRoot;
+		node->VirtualLosses.fetch_add(1, std::memory_order_relaxed);
+		path.push_back(node);
+		Game::GameResult result = Game::GameResult::NONE;
+		while (result == Game::GameResult::NONE) {
+			bool expandedThisIteration = false;
+			if (node->State.load(std::memory_order_acquire) != ExpansionState::EXPANDED) {
+				if (!Expand(*node, game)) {
+					// Another thread is expanding the node (or the tree is full), so we just play out its position
+					break;
+				}
+				expandedThisIteration = true;
+			}
+
+			node = &SelectChild(*node);
+			node->VirtualLosses.fetch_add(1, std::memory_order_relaxed);
+			path.push_back(node);
+			result = Game::PlayoutEngine::PlayMove(game, node->Move);
+			if (expandedThisIteration) {
+				break;
+			}
+		}
+
+		// Simulation
+		if (result == Game::GameResult::NONE) {
+			result = playoutEngine.Play(game, c_MaxPlayoutTurns);
+		}
+
+		// Backpropagation
+		for (Node* visitedNode : path) {
+			visitedNode->TotalReward.fetch_add(GetReward(visitedNode->Player, result), std::memory_order_relaxed);
+			visitedNode->Visits.fetch_add(1, std::memory_order_relaxed);
+			visitedNode->VirtualLosses.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	bool MCTSStrategy::Expand(Node& node, const Game::Game& game) {
+		const Game::PlayerId playerId = game.GetActivePlayer();
+		return Expand(node, playerId, game.GetLegalMoves(playerId), game);
+	}
+
+	bool MCTSStrategy::Expand(Node& node, Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game) {
+		auto expectedState = ExpansionState::UNEXPANDED;
+		if (!node.State.compare_exchange_strong(expectedState, ExpansionState::EXPANDING, std::memory_order_acq_rel)) {
+			return false;
+		}
+
+		Node* children = nullptr;
+		std::size_t childCount = 0;
+		if (legalMoves.empty()) {
+			// The player has no pieces in hand, so their only option is to pass
+			children = mArena.Allocate(1);
+			if (children) {
+				children[0].Reset({}, playerId, 1.f);
+				childCount = 1;
+			}
+		} else {
+			const auto candidateMoves = MinMax::SortAndFilterMovements(playerId, legalMoves, game.GetBoard());
+			children = mArena.Allocate(candidateMoves.size());
+			if (children) {
+				// The priors are the softmax of the heuristic scores of the moves. The moves are sorted by score,
+				// so the first one has the highest score and we can subtract it to avoid overflows.
+				const float maxScore = static_cast<float>(candidateMoves[0].Score);
+				std::array<float, Game::c_MaxLegalMovesCount> weights;
+				float totalWeight = 0.f;
+				for (std::size_t i = 0; i < candidateMoves.size(); i++) {
+					weights[i] = std::exp((static_cast<float>(candidateMoves[i].Score) - maxScore) / c_PriorTemperature);
+					totalWeight += weights[i];
+				}
+				for (std::size_t i = 0; i < candidateMoves.size(); i++) {
+					children[i].Reset(candidateMoves[i], playerId, weights[i] / totalWeight);
+				}
+				childCount = candidateMoves.size();
+			}
+		}
+
+		if (!children) {
+			// The tree is full, so the node remains a leaf
+			node.State.store(ExpansionState::UNEXPANDED, std::memory_order_release);
+			return false;
+		}
+		node.Children = children;
+		node.ChildCount = static_cast<std::uint8_t>(childCount);
+		node.State.store(ExpansionState::EXPANDED, std::memory_order_release);
+		return true;
+	}
+
+	Node& MCTSStrategy::SelectChild(Node& node) const {
+		const std::uint32_t parentVisits = node.Visits.load(std::memory_order_relaxed) + node.VirtualLosses.load(std::memory_order_relaxed);
+		const float exploration = c_ExplorationConstant * std::sqrt(static_cast<float>(std::max(parentVisits, 1U)));
+
+		Node* bestChild = &node.Children[0];
+		float bestScore = std::numeric_limits<float>::lowest();
+		for (std::size_t i = 0; i < node.ChildCount; i++) {
+			Node& child = node.Children[i];
+			const std::uint32_t childVisits = child.Visits.load(std::memory_order_relaxed) + child.VirtualLosses.load(std::memory_order_relaxed);
+			const float score = child.GetValue() + exploration * child.Prior / static_cast<float>(1 + childVisits);
+			if (score > bestScore) {
+				bestScore = score;
+				bestChild = &child;
+			}
+		}
+		return *bestChild;
+	}
+
+	bool MCTSStrategy::TryStartIteration() {
+		if (mMaxIterations > 0 && mStartedIterations.fetch_add(1, std::memory_order_relaxed) >= mMaxIterations) {
+			return false;
+		}
+		return mMaxTime.count() == 0 || std::chrono::steady_clock::now() < mDeadline;
+	}
+
+	std::size_t MCTSStrategy::GetLastIterationCount() const {
+		return mLastIterationCount;
+	}
+}
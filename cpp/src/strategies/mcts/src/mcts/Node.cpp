@@ -0,0 +1,24 @@
+#include "mcts/Node.hpp"
+#include "mcts/config.hpp"
+
+namespace Alphalcazar::Strategy::MCTS {
+	void Node::Reset(const Game::PlacementMove& move, Game::PlayerId player, float prior) {
+		Move = move;
+		Player = player;
+		Prior = prior;
+		Visits.store(0, std::memory_order_relaxed);
+		VirtualLosses.store(0, std::memory_order_relaxed);
+		TotalReward.store(0, std::memory_order_relaxed);
+		State.store(ExpansionState::UNEXPANDED, std::memory_order_relaxed);
+		Children = nullptr;
+		ChildCount = 0;
+	}
+
+	float Node::GetValue() const {
+		const std::uint32_t visits = Visits.load(std::memory_order_relaxed) + VirtualLosses.load(std::memory_order_relaxed);
+		if (visits == 0) {
+			return c_UnvisitedNodeValue;
+		}
+		return static_cast<float>(TotalReward.load(std::memory_order_relaxed)) / (2.f * static_cast<float>(visits));
+	}
+}
@@ -0,0 +1,47 @@
+#include "mcts/NodeArena.hpp"
+#include "mcts/config.hpp"
+
+#include <cassert>
+
+namespace Alphalcazar::Strategy::MCTS {
+	NodeArena::NodeArena(std::size_t maxNodeCount)
+		: mMaxNodeCount { maxNodeCount }
+	{}
+
+	Node* NodeArena::Allocate(std::size_t count) {
+		assert(count <= c_NodeArenaBlockSize);
+		std::lock_guard lock{ mMutex };
+		if (mAllocatedNodeCount + count > mMaxNodeCount) {
+			return nullptr;
+		}
+
+		if (mBlocks.empty() || mCurrentBlockOffset + count > c_NodeArenaBlockSize) {
+			// The nodes don't fit in the current block, so we move on to the next one (allocating it if needed).
+			// The remaining nodes of the current block are left unused, as allocations must be contiguous.
+			if (!mBlocks.empty()) {
+				mCurrentBlock++;
+			}
+			if (mCurrentBlock == mBlocks.size()) {
+				mBlocks.emplace_back(std::make_unique<Node[]>(c_NodeArenaBlockSize));
+			}
+			mCurrentBlockOffset = 0;
+		}
+
+		Node* nodes = &mBlocks[mCurrentBlock][mCurrentBlockOffset];
+		mCurrentBlockOffset += count;
+		mAllocatedNodeCount += count;
+		return nodes;
+	}
+
+	void NodeArena::Reset() {
+		std::lock_guard lock{ mMutex };
+		mCurrentBlock = 0;
+		mCurrentBlockOffset = 0;
+		mAllocatedNodeCount = 0;
+	}
+
+	std::size_t NodeArena::GetAllocatedNodeCount() const {
+		std::lock_guard lock{ mMutex };
+		return mAllocatedNodeCount;
+	}
+}
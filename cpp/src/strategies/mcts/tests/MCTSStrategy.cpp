@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include "mcts/MCTSStrategy.hpp"
+
+#include <game/Game.hpp>
+#include <game/parameters.hpp>
+#include <game/PlacementMove.hpp>
+
+#include <game/testhelpers.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+namespace Alphalcazar::Strategy::MCTS {
+	TEST(MCTSStrategy, TestWinningSecondMove) {
+		/*
+		 * Player 2 goes second and has the opportunity to immediatelly win the game
+		 * by placing their 2 piece on (4,2) that will move to (3,2).
+		 *
+		 * See the test with the same setup of the minmax strategy for more details.
+		 */
+		const std::vector<Game::PieceSetup> pieceSetups {
+			{ Game::PlayerId::PLAYER_TWO, 3, Game::Direction::NORTH, { 1, 1 } },
+			{ Game::PlayerId::PLAYER_TWO, 4, Game::Direction::NORTH, { 2, 1 } },
+
+			{ Game::PlayerId::PLAYER_ONE, 3, Game::Direction::SOUTH, { 3, 3 } },
+			{ Game::PlayerId::PLAYER_ONE, 4, Game::Direction::EAST, { 0, 3 } }
+		};
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_TWO);
+		const Game::Coordinates winningCoordinates{ 4, 2 };
+		for (bool multithreaded : { false, true }) {
+			MCTSStrategy strategy{ 2000, std::chrono::milliseconds{ 0 }, multithreaded };
+			const auto move = strategy.Execute(Game::PlayerId::PLAYER_TWO, legalMoves, game);
+
+			EXPECT_EQ(move.Coordinates, winningCoordinates);
+			EXPECT_EQ(move.PieceType, 2);
+			EXPECT_EQ(strategy.GetLastIterationCount(), 2000);
+		}
+	}
+
+	TEST(MCTSStrategy, TestPlayerMustUsePusherPiece) {
+		/*
+		 * Player 1 can only avoid losing this turn by playing the pushing piece on either
+		 * the (2,0) or the (2,4) tile or on the (0,3) tile.
+		 *
+		 * See the test with the same setup of the minmax strategy for more details.
+		 */
+		const std::vector<Game::PieceSetup> pieceSetups {
+			{ Game::PlayerId::PLAYER_TWO, 5, Game::Direction::SOUTH, { 2, 3 } },
+			{ Game::PlayerId::PLAYER_TWO, 2, Game::Direction::SOUTH, { 3, 3 } },
+			{ Game::PlayerId::PLAYER_TWO, 3, Game::Direction::NORTH, { 1, 1 } },
+			{ Game::PlayerId::PLAYER_TWO, 1, Game::Direction::WEST, { 4, 3 } },
+
+			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::WEST, { 1, 3 } }
+		};
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_TWO, true, pieceSetups);
+		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
+
+		MCTSStrategy strategy{ 4000, std::chrono::milliseconds{ 0 }, false };
+		const auto move = strategy.Execute(Game::PlayerId::PLAYER_ONE, legalMoves, game);
+
+		const std::vector<Game::Coordinates> expectedCoordinates {
+			{ 2, 0 },
+			{ 2, 4 },
+			{ 0, 3 }
+		};
+		EXPECT_EQ(move.PieceType, Game::c_PusherPieceType);
+		EXPECT_NE(std::find(expectedCoordinates.begin(), expectedCoordinates.end(), move.Coordinates), expectedCoordinates.end());
+	}
+
+	TEST(MCTSStrategy, RestrictedLegalMoves) {
+		// Only the moves allowed by the caller are searched, even if the position has better ones
+		const Game::Game game{};
+		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
+		Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount> restrictedMoves;
+		restrictedMoves.insert(legalMoves[0]);
+		restrictedMoves.insert(legalMoves[legalMoves.size() - 1]);
+		for (bool multithreaded : { false, true }) {
+			MCTSStrategy strategy{ 500, std::chrono::milliseconds{ 0 }, multithreaded };
+			const auto move = strategy.Execute(Game::PlayerId::PLAYER_ONE, restrictedMoves, game);
+			EXPECT_NE(std::find(restrictedMoves.begin(), restrictedMoves.end(), move), restrictedMoves.end());
+		}
+	}
+
+	TEST(MCTSStrategy, TimeLimit) {
+		// Without an iteration limit, the search runs until the time limit is reached
+		const Game::Game game{};
+		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
+		MCTSStrategy strategy{ 0, std::chrono::milliseconds{ 50 } };
+
+		const auto start = std::chrono::steady_clock::now();
+		const auto move = strategy.Execute(Game::PlayerId::PLAYER_ONE, legalMoves, game);
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+
+		EXPECT_TRUE(move.Valid());
+		EXPECT_GT(strategy.GetLastIterationCount(), 0);
+		EXPECT_GE(elapsed, std::chrono::milliseconds{ 50 });
+		EXPECT_LT(elapsed, std::chrono::milliseconds{ 1000 });
+	}
+
+	TEST(MCTSStrategy, SelfPlayGameEnds) {
+		// A full game between two MCTS strategies should always reach a result
+		Game::Game game{};
+		MCTSStrategy strategy{ 200, std::chrono::milliseconds{ 0 } };
+		const auto result = game.Play(strategy, strategy);
+		EXPECT_NE(result, Game::GameResult::NONE);
+	}
+}
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include "mcts/NodeArena.hpp"
+#include "mcts/config.hpp"
+
+namespace Alphalcazar::Strategy::MCTS {
+	TEST(NodeArena, Allocate) {
+		NodeArena arena{ c_NodeArenaBlockSize * 2 };
+		Node* first = arena.Allocate(10);
+		Node* second = arena.Allocate(5);
+		ASSERT_NE(first, nullptr);
+		// Consecutive allocations are contiguous while they fit in the same block
+		EXPECT_EQ(second, first + 10);
+		EXPECT_EQ(arena.GetAllocatedNodeCount(), 15);
+
+		// Allocations that don't fit in the rest of the block are moved to a new block
+		Node* third = arena.Allocate(c_NodeArenaBlockSize - 10);
+		ASSERT_NE(third, nullptr);
+		EXPECT_TRUE(third < first || third >= first + c_NodeArenaBlockSize);
+
+		// Allocations past the maximum node count fail
+		EXPECT_EQ(arena.Allocate(c_NodeArenaBlockSize), nullptr);
+	}
+
+	TEST(NodeArena, Reset) {
+		NodeArena arena{ c_NodeArenaBlockSize };
+		Node* first = arena.Allocate(c_NodeArenaBlockSize);
+		ASSERT_NE(first, nullptr);
+		EXPECT_EQ(arena.Allocate(1), nullptr);
+
+		// After a reset, the same memory is handed out again
+		arena.Reset();
+		EXPECT_EQ(arena.GetAllocatedNodeCount(), 0);
+		EXPECT_EQ(arena.Allocate(1), first);
+	}
+
+	TEST(NodeArena, NodeValue) {
+		Node node;
+		node.Reset({}, Game::PlayerId::PLAYER_ONE, 0.5f);
+		EXPECT_EQ(node.GetValue(), c_UnvisitedNodeValue);
+
+		// A win and a draw
+		node.Visits = 2;
+		node.TotalReward = 3;
+		EXPECT_FLOAT_EQ(node.GetValue(), 0.75f);
+
+		// Virtual losses make the node look worse while threads are searching through it
+		node.VirtualLosses = 2;
+		EXPECT_FLOAT_EQ(node.GetValue(), 0.375f);
+	}
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "minmax/config.hpp"
+#include "minmax/minmax_aliases.hpp"
+#include "minmax/PolicyTable.hpp"
+
+#include <game/Coordinates.hpp>
+#include <game/PieceScoreTable.hpp>
+#include <game/aliases.hpp>
+#include <game/parameters.hpp>
+
+#include <array>
+
+namespace Alphalcazar::Strategy::MinMax {
+	/// The amount of different opponent board piece counts (0 to \ref c_PieceTypes, both inclusive)
+	constexpr std::size_t c_OpponentPieceCounts = Game::c_PieceTypes + 1;
+
+	/// Returns the coordinates one tile away from the given coordinates in the specified direction
+	constexpr Game::Coordinates GetAdjacentCoordinates(const Game::Coordinates& coordinates, Game::Direction direction) {
+		const auto& offset = Game::c_DirectionOffsets[static_cast<std::size_t>(direction)];
+		return { coordinates.x + offset.first, coordinates.y + offset.second };
+	}
+
+	/*!
+	 * \brief Returns a score multiplier for the heuristic score of a piece given its position and direction on the board.
+	 *
+	 * Grants a higher multiplier for pieces that are well positioned (ex. in the center) or have a long expected
+	 * lifetime (ex. facing towards the board interior) and a lower multiplier for pieces that are badly positioned or
+	 * with a short expected lifetime (ex. about to exit the board).
+	 */
+	constexpr float GetPieceScoreMultiplier(const Game::Coordinates& coordinates, Game::Direction direction) {
+		if (coordinates.IsCenter()) {
+			return c_CenterPieceMultiplier;
+		}
+
+		if (coordinates.IsBoardCorner()) {
+			// In the board corners, a piece can only have recently entered the board
+			// or be about to leave it
+			if (GetAdjacentCoordinates(coordinates, direction).IsPerimeter()) {
+				return c_PieceAboutToExitMultiplier;
+			}
+			return c_FreshCornerPieceMultiplier;
+		}
+
+		// The piece is on one of the center lanes, but not in the center tile
+		const auto pieceTargetCoordinate = GetAdjacentCoordinates(coordinates, direction);
+		if (pieceTargetCoordinate.IsPerimeter()) {
+			// The piece is about to exit the board
+			return c_PieceAboutToExitMultiplier;
+		}
+
+		if (pieceTargetCoordinate.IsCenter()) {
+			// The piece just entered the center lane and wants to move to the center
+			return c_FreshCenterLanePieceMultiplier;
+		}
+		return 1.f;
+	}
+
+	/*!
+	 * \brief Builds the \ref c_PieceScoreTable.
+	 *
+	 * Each entry holds the score that \ref EvaluateBoard grants a piece on that tile and direction: its on-board score
+	 * scaled by \ref GetPieceScoreMultiplier. Pieces outside of the board (on the perimeter) are worth nothing.
+	 *
+	 * Entries are indexed by \ref Game::GetPieceScoreTableIndex.
+	 */
+	constexpr Game::PieceScoreTable BuildPieceScoreTable() {
+		Game::PieceScoreTable table{};
+		for (Game::Coordinate x = 1; x <= Game::c_BoardSize; x++) {
+			for (Game::Coordinate y = 1; y <= Game::c_BoardSize; y++) {
+				const Game::Coordinates coordinates{ x, y };
+				for (std::size_t direction = 1; direction < static_cast<std::size_t>(Game::Direction::SIZE); direction++) {
+					const float multiplier = GetPieceScoreMultiplier(coordinates, static_cast<Game::Direction>(direction));
+					for (Game::PieceType pieceType = 1; pieceType <= Game::c_PieceTypes; pieceType++) {
+						const Score pieceOnBoardScore = c_PieceOnBoardScores[pieceType - 1];
+						table[Game::GetPieceScoreTableIndex(coordinates, static_cast<Game::Direction>(direction), pieceType)] = static_cast<Score>(pieceOnBoardScore * multiplier);
+					}
+				}
+			}
+		}
+		return table;
+	}
+
+	/*!
+	 * \brief Lookup table with the heuristic score of every piece type on every tile and direction. See \ref BuildPieceScoreTable
+	 *
+	 * Can be set as the piece score table of a board (see \ref Game::Board::SetPieceScoreTable) to make \ref EvaluateBoard O(1).
+	 */
+	inline constexpr Game::PieceScoreTable c_PieceScoreTable = BuildPieceScoreTable();
+
+	/// Returns the index of the \ref c_PlacementMoveScoreTable entry of a placement move, given the amount of pieces the opponent has on the board
+	constexpr std::size_t GetPlacementMoveScoreTableIndex(const Game::Coordinates& coordinates, Game::PieceType pieceType, std::size_t opponentBoardPieceCount) {
+		return (Game::GetTileIndex(coordinates) * Game::c_PieceTypes + pieceType - 1) * c_OpponentPieceCounts + opponentBoardPieceCount;
+	}
+
+	/// The amount of entries of the \ref c_PlacementPolicyTable: one per perimeter tile, piece type and opponent board piece count
+	constexpr std::size_t c_PlacementPolicyTableSize = Game::c_PerimeterTileCount * Game::c_PieceTypes * c_OpponentPieceCounts;
+	static_assert(c_PlacementPolicyTable.size() == c_PlacementPolicyTableSize, "The policy table must be generated again");
+
+	/// Returns the index of the \ref c_PlacementPolicyTable entry of a placement move, given the amount of pieces the opponent has on the board
+	constexpr std::size_t GetPlacementPolicyTableIndex(const Game::Coordinates& coordinates, Game::PieceType pieceType, std::size_t opponentBoardPieceCount) {
+		constexpr auto perimeterCoordinates = Game::Coordinates::GetPerimeterCoordinates();
+		std::size_t perimeterIndex = 0;
+		while (perimeterCoordinates[perimeterIndex] != coordinates) {
+			perimeterIndex++;
+		}
+		return (perimeterIndex * Game::c_PieceTypes + pieceType - 1) * c_OpponentPieceCounts + opponentBoardPieceCount;
+	}
+
+	/*!
+	 * \brief Builds the \ref c_PlacementMoveScoreTable.
+	 *
+	 * Each entry holds the heuristic score of placing a piece type on a perimeter tile (assuming that the piece will be able
+	 * to enter the board), for every amount of pieces the opponent may have on the board.
+	 */
+	constexpr std::array<Score, Game::c_TileIndexCount * Game::c_PieceTypes * c_OpponentPieceCounts> BuildPlacementMoveScoreTable() {
+		std::array<Score, Game::c_TileIndexCount * Game::c_PieceTypes * c_OpponentPieceCounts> table{};
+		for (const auto& coordinates : Game::Coordinates::GetPerimeterCoordinates()) {
+			for (Game::PieceType pieceType = 1; pieceType <= Game::c_PieceTypes; pieceType++) {
+				for (std::size_t opponentBoardPieceCount = 0; opponentBoardPieceCount < c_OpponentPieceCounts; opponentBoardPieceCount++) {
+					// We use the heuristic score of the piece as a base value for the final heuristic score
+					Score resultScore = c_PieceOnBoardScores[pieceType - 1];
+
+					// Check the docstring for \ref c_PusherBonusPerOpponentPiece for more information
+					if (pieceType == Game::c_PusherPieceType && opponentBoardPieceCount >= 2) {
+						resultScore += static_cast<Score>(c_PusherBonusPerOpponentPiece * opponentBoardPieceCount);
+					}
+
+					// We adjust the score based on if the piece is on the center lane (more valuable) or a lateral lane.
+					// We multiply the positive scores and divide the negative scores by the multiplier, as a higher lane multiplier
+					// is meant to always increase the absolute value of the move score
+					const float laneMultiplier = coordinates.IsOnCenterLane() ? c_FreshCenterLanePieceMultiplier : c_FreshCornerPieceMultiplier;
+					if (resultScore >= 0) {
+						resultScore = static_cast<Score>(resultScore * laneMultiplier);
+					} else {
+						resultScore = static_cast<Score>(resultScore / laneMultiplier);
+					}
+
+					// Moves that were often played in self-play get a bonus, see \ref c_PlacementPolicyTable
+					resultScore += c_PlacementPolicyScore * c_PlacementPolicyTable[GetPlacementPolicyTableIndex(coordinates, pieceType, opponentBoardPieceCount)] / 255;
+
+					table[GetPlacementMoveScoreTableIndex(coordinates, pieceType, opponentBoardPieceCount)] = resultScore;
+				}
+			}
+		}
+		return table;
+	}
+
+	/// Lookup table with the heuristic score of every placement move. See \ref BuildPlacementMoveScoreTable
+	inline constexpr auto c_PlacementMoveScoreTable = BuildPlacementMoveScoreTable();
+}
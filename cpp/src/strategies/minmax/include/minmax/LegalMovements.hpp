@@ -32,6 +32,37 @@ namespace Alphalcazar::Strategy::MinMax {
 	 */
 	std::pair<bool, bool> GetBoardSymmetries(const Game::Board& board);
 
+	/*!
+	 * \brief Returns whether a placement on the specified coordinates is filtered out because the board is symmetrical
+	 *        and an equivalent placement on the other side of the symmetry axes is kept instead.
+	 *
+	 * \param xSymmetry, ySymmetry The symmetries of the board, see \ref GetBoardSymmetries.
+	 */
+	bool IsSymmetricalPlacement(const Game::Coordinates& coordinates, bool xSymmetry, bool ySymmetry);
+
+	/*!
+	 * \brief Returns whether we have good reason to believe that the piece of a placement move won't even enter the board,
+	 *        because the tile in front of it is occupied by a piece that won't leave it before the placed piece moves.
+	 */
+	bool IsPlacementBlocked(const Game::PlacementMove& move, const Game::Board& board);
+
+	/*!
+	 * \brief Returns the heuristic score of a placement move assuming its piece enters the board, which is an upper bound of
+	 *        \ref GetHeuristicPlacementMoveScore that doesn't need to look at the board.
+	 *
+	 * \param opponentBoardPieceCount Amount of pieces the opponent has on the board (excluding perimeter).
+	 */
+	Score GetUnblockedPlacementMoveScore(const Game::PlacementMove& move, std::size_t opponentBoardPieceCount);
+
+	/*!
+	 * \brief Returns an heuristic approximation of the score we expect to gain from a given placement move, for sorting purposes.
+	 *
+	 * \param move The move for which to calculate the heuristic approximation.
+	 * \param board The board of the game for which the legal movement is valid.
+	 * \param opponentBoardPieceCount Amount of pieces the opponent has on the board (excluding perimeter).
+	 */
+	Score GetHeuristicPlacementMoveScore(const Game::PlacementMove& move, const Game::Board& board, std::size_t opponentBoardPieceCount);
+
 	/*!
 	 * \brief Filters a list of legal movements based on board symmetries and sorts them by their heuristic score.
 	 * 
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace Alphalcazar::Utils {
+	class ThreadPool;
+}
+
+namespace Alphalcazar::Strategy::MinMax {
+	struct NeuralNetwork;
+
+	/// The positions the \ref MinMaxStrategy searches in the background while the opponent decides on their moves
+	enum class PonderMode {
+		/// No pondering
+		NONE,
+		/// Only the position reached if the opponent plays the replies predicted by the last search
+		PREDICTED_REPLY,
+		/// The positions reached by every reply of the opponent to the last move (further opponent moves follow the prediction)
+		ALL_REPLIES
+	};
+
+	/// Optional search modes of the \ref MinMaxStrategy. The defaults run a plain min-max search.
+	struct MinMaxOptions {
+		/// If set, leaf positions are evaluated with this neural network (see \ref EvaluateBoardNeural) instead of with \ref EvaluateBoard
+		std::shared_ptr<const NeuralNetwork> Network;
+
+		/*!
+		 * \brief The amount of random playouts (see \ref Game::PlayoutEngine) run from each leaf position, or 0 to disable them.
+		 *
+		 * The outcome of the playouts is blended with the heuristic score of the leaf (see \ref LeafPlayoutWeight). Each playout
+		 * is limited to \ref c_LeafPlayoutMaxTurns turns, which bounds the extra cost per leaf.
+		 */
+		std::size_t LeafPlayouts = 0;
+
+		/// The weight, from 0 to 1, of the outcome of the playouts in the score of a leaf (see \ref LeafPlayouts)
+		float LeafPlayoutWeight = 0.5f;
+
+		/*!
+		 * \brief Whether, after returning a move, the strategy keeps searching on the thread pool the positions in which it
+		 *        expects to play its next move (see \ref PonderMode).
+		 *
+		 * If the next \ref MinMaxStrategy::Execute call is for one of those positions, it is answered from the work already done
+		 * in the background, and all other background searches are stopped. The returned move is the same as without pondering.
+		 * Pondering always uses the thread pool, even if the strategy is not multithreaded.
+		 */
+		PonderMode Ponder = PonderMode::NONE;
+
+		/*!
+		 * \brief The thread pool that runs the multithreaded and background searches, or nullptr to use the one shared by the
+		 *        whole process (see \ref Utils::ThreadPool::GetShared). The pool must outlive the strategy.
+		 */
+		Utils::ThreadPool* ThreadPool = nullptr;
+
+		/*!
+		 * \brief The max amount of threads searching the same position at once, counting the thread waiting for the search,
+		 *        or 0 for as many as the thread pool has, plus that thread.
+		 *
+		 * Lets several strategies share the thread pool without one of them taking all of its threads. Every background
+		 * search (see \ref Ponder) has its own limit.
+		 */
+		std::size_t MaxThreads = 0;
+	};
+}
@@ -1,12 +1,17 @@
 #pragma once
 
 #include "minmax/minmax_aliases.hpp"
+#include "minmax/MinMaxOptions.hpp"
+#include "minmax/PrincipalVariation.hpp"
+#include "minmax/SearchStatistics.hpp"
 
 #include <game/Strategy.hpp>
 #include <game/aliases.hpp>
+#include <util/StopToken.hpp>
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 namespace Alphalcazar::Game {
 	struct PlacementMove;
@@ -18,6 +23,9 @@ namespace Alphalcazar::Utils {
 }
 
 namespace Alphalcazar::Strategy::MinMax {
+	struct SearchContext;
+	struct SearchState;
+	struct ScoredPlacementMove;
 
 	/*!
 	 * \brief A strategy that determines the move to play by using a min-max algorithm
@@ -29,37 +37,162 @@ namespace Alphalcazar::Strategy::MinMax {
 	 */
 	class MinMaxStrategy final : public Game::Strategy {
 	public:
-		MinMaxStrategy(Depth depth, bool multithreaded = true);
+		MinMaxStrategy(Depth depth, bool multithreaded = true, const MinMaxOptions& options = {});
 		~MinMaxStrategy() override;
 
 		Game::PlacementMove Execute(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game) override;
 
+		/*!
+		 * \brief Same as \ref Execute, but stops searching once a stop is requested on the token or its deadline passes.
+		 *
+		 * A stopped search returns the best move among the root moves it searched completely, or the move with the best
+		 * heuristic score (with a score of 0) if it did not complete any. Its queued tasks are dropped from the thread pool.
+		 */
+		Game::PlacementMove ExecuteStoppable(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game, const Utils::StopToken& stopToken) override;
+
 		/// Returns the score calculated for the move returned by the last \ref Execute function call
 		Score GetLastExecutedMoveScore() const;
+
+		/// Returns whether the last \ref Execute function call was answered from a background search (see \ref MinMaxOptions::Ponder)
+		bool GetLastExecutedMovePondered() const;
+
+		/*!
+		 * \brief Returns the statistics of the search of the last \ref Execute or \ref Analyze function call.
+		 *
+		 * Always empty unless the statistics are collected (see \ref c_CollectSearchStatistics). A search answered from a
+		 * background search includes the work done in the background, and a move that wins this turn has empty statistics.
+		 */
+		const SearchStatistics& GetLastSearchStatistics() const;
+
+		/*!
+		 * \brief Searches the position like \ref Execute, but returns the best \p moveCount moves instead of only the best one.
+		 *
+		 * Every returned move has its exact score and its principal variation. Symmetrical moves are filtered out as in
+		 * \ref SortAndFilterMovements, and all remaining moves are searched, including the ones that decide the game this turn.
+		 *
+		 * \returns The best moves, from best to worst. Fewer than \p moveCount if there are not as many candidate moves.
+		 */
+		std::vector<AnalyzedMove> Analyze(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game, std::size_t moveCount);
 	private:
+		/// A search of the root moves of a position, started by \ref StartSearch and completed by \ref FinishSearch
+		struct PendingSearch;
+
+		/*!
+		 * \brief Starts searching all candidate moves of the root of a search, to find the best \p moveCount ones.
+		 *
+		 * Every move is searched with the score of the worst move kept so far as its alpha, so that only moves that can still
+		 * make it into the best ones get exact scores.
+		 *
+		 * \param game The position to search, with the piece score table set on its board.
+		 * \param collectPrincipalVariations Whether the principal variation of the returned moves is collected.
+		 * \param async Whether every candidate move is searched on the thread pool right away. Otherwise, the moves are searched
+		 *              one after the other on the thread calling \ref FinishSearch.
+		 * \param stopToken The token that stops the search.
+		 */
+		std::unique_ptr<PendingSearch> StartSearch(Game::PlayerId playerId, const Utils::StaticVector<ScoredPlacementMove, Game::c_MaxLegalMovesCount>& candidateMoves, const Game::Game& game, std::size_t moveCount, bool collectPrincipalVariations, bool async, const Utils::StopToken& stopToken);
+
+		/*!
+		 * \brief Starts the search of an \ref Execute call: the search of the best move among the legal moves, without the ones
+		 *        that lose this turn. A move that wins this turn is returned without searching (see \ref GetTacticalOutcomes).
+		 */
+		std::unique_ptr<PendingSearch> StartExecuteSearch(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game, bool async, const Utils::StopToken& stopToken);
+
+		/*!
+		 * \brief Waits for a search to complete and returns its best moves, from best to worst, with exact scores.
+		 *
+		 * If the search is stopped, only the moves that were searched completely are returned. If there are none,
+		 * the candidate move with the best heuristic score is returned, with a score of 0.
+		 *
+		 * \param stopToken A token that also stops the search, for searches that were started with another one.
+		 */
+		std::vector<AnalyzedMove> FinishSearch(PendingSearch& search, const Utils::StopToken& stopToken);
+
+		/// Queues as many tasks as threads may search the candidate moves of the search that no task has started yet (see \ref MinMaxOptions::MaxThreads)
+		void QueueCandidateMovesSearches(PendingSearch& search);
+
+		/// Queues a task on the thread pool that searches the candidate moves of the search no other task has started yet
+		void QueueCandidateMovesSearch(PendingSearch& search);
+
+		/*!
+		 * \brief Searches the candidate moves of the search no other task has started yet, one after the other.
+		 *
+		 * Between moves, hands the rest of the work over to a new task if tasks of a higher priority are waiting, so that
+		 * background searches don't delay the live ones (see \ref Utils::TaskPriority). Returns if the priority of the search
+		 * changed, as the tasks queued with the new priority take over.
+		 */
+		void SearchCandidateMoves(PendingSearch& search);
+
+		/*!
+		 * \brief Searches a root move, collecting its principal variation if the context has a principal variation table.
+		 *
+		 * \returns The searched move, or an invalid move if the search was stopped before the move was searched completely.
+		 */
+		AnalyzedMove SearchRootMove(Game::PlayerId playerId, const Game::PlacementMove& move, const Game::Game& game, Score alpha, SearchContext& context);
+
+		/*!
+		 * \brief Starts searching in the background the positions in which the player is expected to play their next move,
+		 *        after playing the specified move (see \ref MinMaxOptions::Ponder).
+		 */
+		void StartPondering(Game::PlayerId playerId, const AnalyzedMove& playedMove, const Game::Game& game);
+
+		/*!
+		 * \brief Returns the background search of the specified position, if there is one, and stops all other background searches.
+		 *
+		 * A background search is only returned if all the moves it searches are among the specified legal moves.
+		 */
+		std::unique_ptr<PendingSearch> TakePonderedSearch(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game);
+
+		/// Stops all background searches and waits for their threads to return
+		void StopPondering();
+
 		/*!
 		 * \brief Explores all possible branches (each being a legal move available to the active player) and returns
 		 *        the score for the best available move.
 		 */
-		Score Max(Game::PlayerId playerId, Depth depth, const Game::Game& game, Score alpha, Score beta);
+		Score Max(Game::PlayerId playerId, Depth depth, const Game::Game& game, Score alpha, Score beta, SearchContext& context);
 
 		/*!
 		 * \brief Explores all possible branches (each being a legal move available to the opponent) and returns
 		 *        the score for the best available move (from the opponent's perspective).
 		 */
-		Score Min(Game::PlayerId playerId, Depth depth, const Game::Game& game, Score alpha, Score beta);
+		Score Min(Game::PlayerId playerId, Depth depth, const Game::Game& game, Score alpha, Score beta, SearchContext& context);
+
+		/*!
+		 * \brief Plays the specified move and returns the score of the resulting position, searching deeper if needed.
+		 *
+		 * Positions that repeat a position found earlier along the line being searched (see \ref SearchContext) are
+		 * scored as a draw, since looping back to them cannot make any progress.
+		 */
+		Score GetNextBestScore(Game::PlayerId playerId, const Game::PlacementMove& move, Depth depth, const Game::Game& game, Score alpha, Score beta, SearchContext& context);
+
+		/*!
+		 * \brief Returns the heuristic score of a position at the end of the search, for the specified player.
+		 *
+		 * If enabled, the score is blended with the outcome of random playouts from the position (see \ref MinMaxOptions::LeafPlayouts).
+		 */
+		Score EvaluateLeaf(Game::PlayerId playerId, const Game::Game& game, SearchContext& context) const;
 
-		Score GetNextBestScore(Game::PlayerId playerId, const Game::PlacementMove& move, Depth depth, const Game::Game& game, Score alpha, Score beta);
+		/// Builds the context for a thread of a search that starts at the specified game position
+		SearchContext CreateSearchContext(const Game::Game& game, bool collectPrincipalVariations, SearchState& state);
 
-		/// The thread pool that will run the min-max algorithm tasks if mMultithreaded is true
-		std::unique_ptr<Utils::ThreadPool> mThreadPool;
-		std::atomic<Score> mFirstLevelAlpha = 0;
+		/// The thread pool that will run the min-max algorithm tasks if mMultithreaded is true, and the background searches (see \ref MinMaxOptions::ThreadPool)
+		Utils::ThreadPool* mThreadPool = nullptr;
+		/// The searches running in the background while the opponent decides on their moves (see \ref MinMaxOptions::Ponder)
+		std::vector<std::unique_ptr<PendingSearch>> mPonderedSearches;
+		/// The seed of the leaf playouts of the next search context, so that every search plays different playouts
+		std::atomic<std::uint64_t> mNextPlayoutSeed = 0;
 
 		/// The score calculated for the move returned by the last \ref Execute function call
 		Score mLastExecutedMoveScore = 0;
+		/// Whether the last \ref Execute function call was answered from a background search
+		bool mLastExecutedMovePondered = false;
+		/// The statistics of the search of the last \ref Execute or \ref Analyze function call
+		CollectedSearchStatistics mLastSearchStatistics;
 		/// The max depth to explore on min-max searches
 		Depth mDepth;
 		/// Whether the min-max search will be run on multiple threads
 		bool mMultithreaded;
+		/// The optional search modes enabled for this strategy
+		MinMaxOptions mOptions;
 	};
 }
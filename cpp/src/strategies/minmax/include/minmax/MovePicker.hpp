@@ -0,0 +1,50 @@
+#pragma once
+
+#include "minmax/LegalMovements.hpp"
+
+#include <game/aliases.hpp>
+#include <game/parameters.hpp>
+#include <util/StaticVector.hpp>
+
+#include <bitset>
+
+namespace Alphalcazar::Game {
+	class Board;
+}
+
+namespace Alphalcazar::Strategy::MinMax {
+	/*!
+	 * \brief Hands out the legal moves of a search node one by one, from the highest to the lowest heuristic score.
+	 *
+	 * Gives the same moves as \ref SortAndFilterMovements, but without sorting them upfront: most nodes of an alpha-beta
+	 * search are cut off after their first one or two moves, so the order of the remaining moves is never needed.
+	 *
+	 * The moves are first scored with \ref GetUnblockedPlacementMoveScore, a cheap upper bound of their heuristic score.
+	 * Each call to \ref Next then selects the move with the highest score among the remaining ones, and only checks
+	 * whether it is blocked (see \ref IsPlacementBlocked) once it is selected, reselecting if its score drops.
+	 *
+	 * \note The board must outlive the picker.
+	 */
+	class MovePicker {
+	public:
+		MovePicker(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Board& board);
+
+		/// Returns the remaining move with the highest heuristic score, or nullptr once all moves have been handed out
+		const ScoredPlacementMove* Next();
+
+		/// Returns the amount of moves the picker hands out in total
+		std::size_t size() const;
+
+		/// Returns the amount of moves handed out so far, so that the last one handed out has this index minus one
+		std::size_t GetHandedOutCount() const;
+	private:
+		/// The moves that have not been filtered out. The first mNextIndex ones have already been handed out, in order.
+		Utils::StaticVector<ScoredPlacementMove, Game::c_MaxLegalMovesCount> mMoves;
+		/// Whether the score of each move of mMoves is its final heuristic score, or still its upper bound
+		std::bitset<Game::c_MaxLegalMovesCount> mExactScores;
+		/// The index of the next move to hand out
+		std::size_t mNextIndex = 0;
+		/// The board the moves are played on
+		const Game::Board& mBoard;
+	};
+}
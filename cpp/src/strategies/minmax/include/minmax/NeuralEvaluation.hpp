@@ -0,0 +1,76 @@
+#pragma once
+
+#include "minmax/minmax_aliases.hpp"
+
+#include <game/aliases.hpp>
+#include <game/parameters.hpp>
+#include <game/PieceFeatureTable.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Alphalcazar::Game {
+	class Board;
+	class Game;
+}
+
+namespace Alphalcazar::Strategy::MinMax {
+	/// The amount of input features of the network: the piece features of the board (see \ref Game::PieceFeatureTable)
+	constexpr std::size_t c_NeuralInputSize = Game::c_PieceFeatureCount;
+	/// The amount of neurons of the first hidden layer, whose weights are accumulated by the board
+	constexpr std::size_t c_NeuralFirstLayerSize = Game::c_PieceFeatureWeights;
+	/// The amount of neurons of the second hidden layer
+	constexpr std::size_t c_NeuralSecondLayerSize = 32;
+	/// The maximum value of the (clipped ReLU) activation of the hidden layers, which represents 1.0
+	constexpr std::int32_t c_NeuralActivationMax = 127;
+	/// The right shift applied to the second layer sums to bring them back to the activation range
+	constexpr std::int32_t c_NeuralSecondLayerShift = 6;
+	/// The right shift applied to the output of the network to turn it into a \ref Score
+	constexpr std::int32_t c_NeuralOutputShift = 4;
+
+	/*!
+	 * \brief The weights of a small quantized neural network that evaluates a board from player one's perspective.
+	 *
+	 * The network is a multilayer perceptron with the following layers:
+	 * - An input layer of \ref c_NeuralInputSize one-hot features. Each piece slot activates exactly one feature:
+	 *   its tile and direction if the piece is in play, or its "piece in hand" feature otherwise.
+	 * - A first hidden layer with 16-bit weights, which the board updates as pieces move (see \ref Game::Board::SetPieceFeatureTable).
+	 * - A second hidden layer and an output neuron with 8-bit weights.
+	 * Both hidden layers use a clipped ReLU activation (from 0 to \ref c_NeuralActivationMax).
+	 */
+	struct NeuralNetwork {
+		/*!
+		 * \brief Loads a network from a file written by \ref Save.
+		 *
+		 * The file starts with the "ALNN" magic number and a format version (both 32-bit), followed by the weights and biases
+		 * of each layer in declaration order, all stored in the (little-endian) byte order of the supported platforms.
+		 *
+		 * \returns The loaded network, or nullptr if the file could not be read or is not a valid network file.
+		 */
+		static std::unique_ptr<NeuralNetwork> Load(const std::string& path);
+		/// Writes the network to a file that can be read by \ref Load. Returns whether the file could be written.
+		bool Save(const std::string& path) const;
+
+		/// The weights of the first hidden layer, stored as one row of \ref c_NeuralFirstLayerSize weights per input feature
+		alignas(32) Game::PieceFeatureTable FirstLayerWeights{};
+		alignas(32) std::array<std::int16_t, c_NeuralFirstLayerSize> FirstLayerBiases{};
+		/// The weights of the second hidden layer, stored as one row of \ref c_NeuralFirstLayerSize weights per neuron
+		alignas(32) std::array<std::array<std::int8_t, c_NeuralFirstLayerSize>, c_NeuralSecondLayerSize> SecondLayerWeights{};
+		alignas(32) std::array<std::int32_t, c_NeuralSecondLayerSize> SecondLayerBiases{};
+		alignas(32) std::array<std::int8_t, c_NeuralSecondLayerSize> OutputWeights{};
+		std::int32_t OutputBias = 0;
+	};
+
+	/// Returns the active input feature of each piece slot of a \ref NeuralNetwork for the specified board
+	std::array<std::size_t, Game::c_PieceFeatureSlots> GetNeuralFeatures(const Game::Board& board);
+
+	/*!
+	 * \brief Evaluates the board of a given game with a neural network and returns a heuristic score for the specified player.
+	 *
+	 * An alternative to \ref EvaluateBoard, with the same player symmetry. If the first layer weights of the network are
+	 * set as the piece feature table of the board, the first layer is read from the board instead of being computed.
+	 */
+	Score EvaluateBoardNeural(Game::PlayerId playerId, const Game::Game& game, const NeuralNetwork& network);
+}
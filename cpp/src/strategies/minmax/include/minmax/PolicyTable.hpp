@@ -0,0 +1,31 @@
+#pragma once
+
+// Generated by Alphalcazar.Tool.PolicyTable from 1000 self-play games at depth 2, with the placement policy turned off. Do not edit by hand.
+
+#include <array>
+#include <cstdint>
+
+namespace Alphalcazar::Strategy::MinMax {
+	/*!
+	 * \brief How often each kind of placement move was played by the min-max strategy in self-play, when it was available.
+	 *
+	 * Scaled from 0 to 255 (the most often played kind of move). Indexed by \ref GetPlacementPolicyTableIndex.
+	 */
+	inline constexpr std::array<std::uint8_t, 360> c_PlacementPolicyTable = {{
+		0, 21, 29, 29, 32, 0, 0, 54, 54, 55, 50, 0, 0, 42, 45, 34, 26, 55, 0, 0, 50, 66, 67, 0,
+		0, 12, 24, 14, 15, 48, 0, 17, 22, 23, 16, 0, 0, 13, 35, 47, 31, 55, 0, 28, 26, 20, 46, 0,
+		0, 5, 32, 47, 59, 64, 0, 4, 13, 14, 20, 0, 0, 22, 30, 19, 29, 0, 0, 158, 113, 139, 133, 0,
+		73, 208, 180, 182, 164, 0, 0, 56, 138, 185, 115, 0, 0, 66, 58, 98, 84, 97, 0, 34, 26, 27, 12, 0,
+		0, 126, 116, 103, 94, 55, 0, 171, 163, 164, 148, 110, 0, 46, 103, 150, 199, 0, 61, 98, 69, 61, 56, 0,
+		69, 31, 20, 25, 27, 0, 0, 62, 36, 32, 38, 0, 0, 51, 26, 23, 13, 55, 0, 0, 35, 52, 90, 0,
+		0, 4, 25, 15, 30, 0, 0, 14, 20, 17, 12, 0, 0, 49, 31, 31, 12, 0, 0, 42, 35, 46, 13, 0,
+		0, 15, 34, 63, 52, 0, 0, 24, 20, 10, 15, 0, 0, 14, 19, 15, 8, 48, 0, 36, 36, 29, 12, 0,
+		0, 23, 20, 33, 13, 0, 0, 0, 29, 66, 59, 0, 0, 20, 28, 24, 34, 0, 0, 21, 15, 19, 8, 0,
+		0, 40, 38, 34, 30, 0, 0, 14, 32, 29, 6, 0, 0, 15, 41, 56, 79, 0, 0, 43, 30, 28, 54, 0,
+		0, 30, 29, 21, 24, 0, 0, 117, 128, 118, 70, 0, 0, 165, 218, 227, 150, 55, 0, 52, 122, 188, 196, 64,
+		0, 85, 62, 83, 65, 48, 67, 48, 20, 24, 24, 0, 69, 171, 106, 137, 113, 0, 0, 161, 232, 222, 208, 0,
+		0, 21, 133, 219, 255, 0, 61, 82, 98, 145, 128, 48, 0, 17, 18, 15, 19, 0, 0, 36, 27, 31, 30, 55,
+		0, 28, 24, 29, 20, 0, 0, 34, 29, 56, 59, 64, 0, 40, 28, 20, 20, 48, 0, 21, 8, 11, 27, 0,
+		0, 49, 38, 30, 49, 0, 0, 51, 37, 40, 26, 0, 0, 10, 31, 73, 102, 64, 61, 31, 33, 20, 20, 0
+	}};
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "minmax/minmax_aliases.hpp"
+
+#include <game/PlacementMove.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace Alphalcazar::Strategy::MinMax {
+	/// A root move of a search, with its exact score and the line of play the search expects to follow it
+	struct AnalyzedMove {
+		/// The root move
+		Game::PlacementMove Move;
+		/// The score of the move for the player executing the search
+		Score Score = 0;
+		/*!
+		 * \brief The placement moves the search expects both players to play, starting with \ref Move and alternating
+		 *        between the players as in \ref Game::Game::PlayNextPlacementMove. Invalid moves are passes.
+		 */
+		std::vector<Game::PlacementMove> PrincipalVariation;
+	};
+
+	/*!
+	 * \brief Triangular table that collects the principal variation of every node along the line being searched.
+	 *
+	 * The line of a ply holds at most as many moves as there are plies left below it, so all lines are stored in a single
+	 * buffer, one after the other, each one shorter than the previous one. A node sets its line to its best move followed by
+	 * the line of the ply below it, so the line of the first ply ends up holding the principal variation of the whole search.
+	 *
+	 * A default constructed table is disabled and ignores all updates, so searches that don't need principal variations
+	 * don't pay for them.
+	 */
+	class PrincipalVariationTable {
+	public:
+		PrincipalVariationTable() = default;
+		/// Creates a table for searches of up to the specified amount of plies (placement moves)
+		explicit PrincipalVariationTable(std::size_t maxPly);
+
+		/// Returns whether the table collects principal variations
+		bool IsEnabled() const;
+
+		/// Empties the line of the specified ply
+		void Clear(std::size_t ply);
+
+		/// Sets the line of the specified ply to the move followed by the line of the next ply
+		void Update(std::size_t ply, const Game::PlacementMove& move);
+
+		/// Returns the line of the specified ply
+		std::vector<Game::PlacementMove> GetLine(std::size_t ply) const;
+	private:
+		/// Returns the index of the first move of the line of the specified ply in mMoves
+		std::size_t GetLineOffset(std::size_t ply) const;
+
+		/// The moves of the lines of all plies
+		std::vector<Game::PlacementMove> mMoves;
+		/// The amount of moves in the line of every ply
+		std::vector<std::size_t> mLineLengths;
+		/// The max amount of plies of the searches the table is used for
+		std::size_t mMaxPly = 0;
+	};
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "minmax/PrincipalVariation.hpp"
+#include "minmax/SearchStatistics.hpp"
+
+#include <game/PlayoutEngine.hpp>
+#include <game/zobrist.hpp>
+#include <util/StopToken.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Alphalcazar::Strategy::MinMax {
+	/*!
+	 * \brief State shared by all the threads of a single search.
+	 *
+	 * Every search has its own one, so that several searches (see \ref MinMaxOptions::Ponder) can run at the same time.
+	 */
+	struct SearchState {
+		/*!
+		 * \brief The alpha of the root moves: the worst of the best scores found so far for them (see \ref BestScores).
+		 *
+		 * Threads raise the alpha of the nodes of the player executing the strategy to it, to share cutoffs between root moves.
+		 */
+		std::atomic<Score> RootAlpha = 0;
+
+		/// Stops the search when requested or once its deadline passes. The threads of a stopped search return right away, with meaningless scores.
+		Utils::StopToken StopToken;
+
+		/// The best scores found so far for the root moves, from best to worst
+		std::vector<Score> BestScores;
+		/// Guards BestScores
+		std::mutex BestScoresMutex;
+
+		/// Combines the statistics of the threads of the search, if collected (see \ref c_CollectSearchStatistics)
+		SearchStatisticsCollector<> Statistics;
+	};
+
+	/*!
+	 * \brief State of a single search thread, passed down the min-max recursion.
+	 *
+	 * Each root move is searched with its own context, so it can be modified without any synchronization.
+	 */
+	struct SearchContext {
+		/// The state shared with the other threads of the search
+		SearchState* State = nullptr;
+
+		/*!
+		 * \brief Hashes of the positions at the start of each turn along the line that is currently being searched.
+		 *
+		 * Used as a stack: a position is pushed before searching the turns that follow it and popped afterwards.
+		 */
+		std::vector<Game::PositionHash> PositionHistory;
+
+		/// Plays the random playouts of the leaf evaluation (see \ref MinMaxOptions::LeafPlayouts). Each search seeds its own one.
+		Game::PlayoutEngine Playouts { 0 };
+
+		/// The amount of nodes visited by this thread, to check the deadline of the search every so often
+		std::uint32_t VisitedNodes = 0;
+
+		/// The placement moves played from the root of the search to the node that is currently being searched
+		std::size_t Ply = 0;
+
+		/// The principal variations of the nodes along the line that is currently being searched, if the search collects them
+		PrincipalVariationTable PrincipalVariations;
+
+		/// The statistics of this thread, merged into the ones of the search once it returns (see \ref c_CollectSearchStatistics)
+		CollectedSearchStatistics Statistics;
+
+		/// Returns whether a position has already been reached along the line that is currently being searched
+		bool IsRepetition(Game::PositionHash hash) const {
+			return std::find(PositionHistory.begin(), PositionHistory.end(), hash) != PositionHistory.end();
+		}
+	};
+}
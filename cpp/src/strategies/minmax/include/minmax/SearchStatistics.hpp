@@ -0,0 +1,158 @@
+#pragma once
+
+#include <game/PlacementMove.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace Alphalcazar::Strategy::MinMax {
+	/*!
+	 * \brief Whether the searches of the \ref MinMaxStrategy collect \ref SearchStatistics.
+	 *
+	 * Enabled by the ENABLE_SEARCH_STATISTICS build option. When disabled, the searches collect them in empty stand-ins
+	 * (see \ref CollectedSearchStatistics and \ref SearchStatisticsCollector), so they neither store nor count anything.
+	 */
+#if defined(ALPHALCAZAR_SEARCH_STATISTICS)
+	constexpr bool c_CollectSearchStatistics = true;
+#else
+	constexpr bool c_CollectSearchStatistics = false;
+#endif
+
+	/// The amount of buckets of \ref SearchStatistics::CutoffsByMoveIndex. The last bucket counts the cutoffs of all later moves.
+	constexpr std::size_t c_CutoffMoveIndexBucketCount = 8;
+
+	/// The statistics of the search of a single root move, see \ref SearchStatistics::RootMoves
+	struct RootMoveStatistics {
+		/// The searched root move
+		Game::PlacementMove Move;
+		/// The amount of nodes visited to search the move, including the root move itself
+		std::uint64_t Nodes = 0;
+		/// The time spent searching the move
+		std::chrono::nanoseconds Time { 0 };
+	};
+
+	/*!
+	 * \brief Counters of a search of the \ref MinMaxStrategy, combined over all the threads of the search.
+	 *
+	 * A node is a placement move played by the search, and its ply is the amount of placement moves played before it
+	 * from the root of the search (the root moves are at ply 0). Only collected if \ref c_CollectSearchStatistics is set.
+	 */
+	struct SearchStatistics {
+		/// The amount of nodes visited at every ply
+		std::vector<std::uint64_t> NodesPerPly;
+		/// The amount of positions scored with the leaf evaluation (including the ones evaluated in batches)
+		std::uint64_t LeafEvaluations = 0;
+		/// The amount of positions scored as a draw because they repeat a position found earlier along the same line
+		std::uint64_t Repetitions = 0;
+		/// The amount of nodes in which a move made the remaining moves irrelevant (an alpha-beta cutoff)
+		std::uint64_t Cutoffs = 0;
+		/// Histogram of the cutoffs by the index of the move that caused them, in the order the moves were searched in
+		std::array<std::uint64_t, c_CutoffMoveIndexBucketCount> CutoffsByMoveIndex {};
+		/// The statistics of every root move searched completely, in the order of the candidate moves of the search
+		std::vector<RootMoveStatistics> RootMoves;
+		/// The time from the start of the search to its results being collected (including any time spent in the background)
+		std::chrono::nanoseconds Duration { 0 };
+
+		/// Counts a node visited at the specified ply
+		void AddNode(std::size_t ply) {
+			if (ply >= NodesPerPly.size()) {
+				NodesPerPly.resize(ply + 1);
+			}
+			NodesPerPly[ply]++;
+		}
+
+		/// Counts a cutoff caused by the move with the specified index
+		void AddCutoff(std::size_t moveIndex) {
+			Cutoffs++;
+			CutoffsByMoveIndex[std::min(moveIndex, c_CutoffMoveIndexBucketCount - 1)]++;
+		}
+
+		/// Counts positions scored with the leaf evaluation
+		void AddLeafEvaluations(std::uint64_t count) {
+			LeafEvaluations += count;
+		}
+
+		/// Counts a position scored as a repetition
+		void AddRepetition() {
+			Repetitions++;
+		}
+
+		/// Adds the statistics of a root move searched completely
+		void AddRootMove(const RootMoveStatistics& rootMove) {
+			RootMoves.push_back(rootMove);
+		}
+
+		/// Adds the counters of another thread of the same search to these ones
+		void Merge(const SearchStatistics& other);
+
+		/// Returns the amount of nodes visited over all plies
+		std::uint64_t GetNodes() const;
+
+		/*!
+		 * \brief Returns the effective branching factor of the search: by how much the amount of nodes grows from a ply to the next
+		 *        one, on average over the searched plies. Returns 0 if fewer than two plies were searched.
+		 */
+		double GetEffectiveBranchingFactor() const;
+
+		/// Returns the amount of nodes visited per second over the duration of the search, or 0 if it took no time
+		double GetNodesPerSecond() const;
+	};
+
+	/// Stands in for the \ref SearchStatistics of a search thread when they are not collected: counts nothing and holds nothing
+	struct NoSearchStatistics {
+		void AddNode(std::size_t) {}
+		void AddCutoff(std::size_t) {}
+		void AddLeafEvaluations(std::uint64_t) {}
+		void AddRepetition() {}
+		void AddRootMove(const RootMoveStatistics&) {}
+		void Merge(const NoSearchStatistics&) {}
+		std::uint64_t GetNodes() const { return 0; }
+	};
+
+	/// The statistics collected by a search thread: \ref SearchStatistics, or an empty stand-in if they are not collected
+	using CollectedSearchStatistics = std::conditional_t<c_CollectSearchStatistics, SearchStatistics, NoSearchStatistics>;
+
+	/// Combines the statistics of the threads of a search as they return, and measures its duration
+	template <bool Enabled = c_CollectSearchStatistics>
+	class SearchStatisticsCollector {
+	public:
+		/// Starts measuring the duration of the search
+		void Start() {
+			mStartTime = std::chrono::steady_clock::now();
+		}
+
+		/// Adds the statistics of a thread of the search. Can be called from any thread.
+		void Merge(const SearchStatistics& statistics) {
+			std::lock_guard<std::mutex> lock { mMutex };
+			mStatistics.Merge(statistics);
+		}
+
+		/// Returns the statistics merged so far, with the time since \ref Start as their duration, once all threads returned
+		SearchStatistics Finish() {
+			mStatistics.Duration = std::chrono::steady_clock::now() - mStartTime;
+			return std::move(mStatistics);
+		}
+	private:
+		/// When the search started
+		std::chrono::steady_clock::time_point mStartTime;
+		/// The statistics of the threads that already returned
+		SearchStatistics mStatistics;
+		/// Guards mStatistics
+		std::mutex mMutex;
+	};
+
+	/// The collector of a search whose statistics are not collected, which holds nothing
+	template <>
+	class SearchStatisticsCollector<false> {
+	public:
+		void Start() {}
+		void Merge(const NoSearchStatistics&) {}
+		NoSearchStatistics Finish() { return {}; }
+	};
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "minmax/LegalMovements.hpp"
+
+#include <game/aliases.hpp>
+#include <game/parameters.hpp>
+#include <util/StaticVector.hpp>
+
+#include <cstdint>
+
+namespace Alphalcazar::Game {
+	class Game;
+}
+
+namespace Alphalcazar::Strategy::MinMax {
+	/// The outcome of a placement move at the end of the current turn
+	enum class TacticalOutcome : std::uint8_t {
+		/// The game doesn't end this turn, or how it ends depends on the reply of the opponent
+		UNKNOWN = 0,
+		/// The player wins at the end of the turn, whatever the opponent replies
+		WIN,
+		/// The opponent has a reply (or a forced pass) that makes them win at the end of the turn
+		LOSS,
+	};
+
+	/*!
+	 * \brief Finds the placement moves that decide the game at the end of the current turn, without searching.
+	 *
+	 * Every move (and, if the opponent places after the player this turn, every reply of the opponent) is played on a copy
+	 * of the board only, the board moves of the turn are executed and the win conditions are checked with row masks
+	 * (see \ref Game::GetRowMaskResult). Turns fast-forwarded after the current one are not considered.
+	 *
+	 * \param playerId The player that plays the moves, which must be the active player of the game.
+	 * \param moves The moves to analyze.
+	 * \param game The game the moves are played on.
+	 *
+	 * \returns The outcome of each move, in the same order as \p moves.
+	 */
+	Utils::StaticVector<TacticalOutcome, Game::c_MaxLegalMovesCount> GetTacticalOutcomes(Game::PlayerId playerId, const Utils::StaticVector<ScoredPlacementMove, Game::c_MaxLegalMovesCount>& moves, const Game::Game& game);
+}
@@ -4,6 +4,7 @@
 #include "game/parameters.hpp"
 
 #include <array>
+#include <cstdint>
 
 namespace Alphalcazar::Strategy::MinMax {
 	/*!
@@ -25,6 +26,19 @@ namespace Alphalcazar::Strategy::MinMax {
 	 */
 	constexpr Score c_DepthScorePenalty = 1;
 
+	/*!
+	 * \brief The leaf score of a position from which the player wins all random playouts (see \ref MinMaxOptions::LeafPlayouts).
+	 *
+	 * Losing all of them scores its negated value. Kept well below the win condition score, since random playouts
+	 * are only an estimate of the chances of the player.
+	 */
+	constexpr Score c_LeafPlayoutScore = 1000;
+	/// The maximum amount of turns of each leaf playout. Playouts that reach it are scored as a draw.
+	constexpr std::size_t c_LeafPlayoutMaxTurns = 20;
+
+	/// The amount of nodes each search thread visits between two checks of the deadline of the search (see \ref Utils::StopToken)
+	constexpr std::uint32_t c_DeadlineCheckInterval = 1024;
+
 	constexpr std::array<Score, Game::c_PieceTypes> c_PieceOnBoardScores{{
 		80, // Piece 1
 		120, // Piece 2
@@ -55,4 +69,17 @@ namespace Alphalcazar::Strategy::MinMax {
 	 * 3 or more pieces on the board. It also makes sure the score of a pusher can't exceed the win score (-40 + 85 * 5 * 1.7 = 655).
 	 */
 	constexpr Score c_PusherBonusPerOpponentPiece = 85;
+
+	/*!
+	 * \brief The score added to the placement moves that were the most often played in self-play (see \ref c_PlacementPolicyTable).
+	 *
+	 * Other placement moves get a proportional fraction of it. Low enough for the heuristic score to stay the main sorting criteria.
+	 * Zero when the ENABLE_PLACEMENT_POLICY build option is turned off, which is how the table is generated, so that the
+	 * self-play games it comes from are not biased by a previous table.
+	 */
+#if defined(ALPHALCAZAR_NO_PLACEMENT_POLICY)
+	constexpr Score c_PlacementPolicyScore = 0;
+#else
+	constexpr Score c_PlacementPolicyScore = 60;
+#endif
 }
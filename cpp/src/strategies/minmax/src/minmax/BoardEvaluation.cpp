@@ -1,5 +1,6 @@
 #include "minmax/BoardEvaluation.hpp"
 #include "minmax/config.hpp"
+#include "minmax/EvaluationTables.hpp"
 
 #include <game/Game.hpp>
 #include <game/Piece.hpp>
@@ -7,42 +8,6 @@
 #include <util/Log.hpp>
 
 namespace Alphalcazar::Strategy::MinMax {
-	/*!
-	 * \brief Returns a score multiplier for the heuristic score of a piece given its position and direction on the board.
-	 *
-	 * Grants a higher multiplier for pieces that are well positioned (ex. in the center) or have a long expected
-	 * lifetime (ex. facing towards the board interior) and a lower multiplier for pieces that are badly positioned or
-	 * with a short expected lifetime (ex. about to exit the board).
-	 */
-	float GetPieceScoreMultiplier(const Game::Coordinates& coordinates, Game::Direction direction) {
-		if (coordinates.IsCenter()) {
-			return c_CenterPieceMultiplier;
-		}
-		
-		if (coordinates.IsBoardCorner()) {
-			// In the board corners, a piece can only have recently entered the board
-			// or be about to leave it
-			const auto pieceTargetCoordinate = coordinates.GetCoordinateInDirection(direction, 1);
-			if (pieceTargetCoordinate.IsPerimeter()) {
-				return c_PieceAboutToExitMultiplier;
-			}
-			return c_FreshCornerPieceMultiplier;
-		}
-		
-		// The piece is on one of the center lanes, but not in the center tile
-		const auto pieceTargetCoordinate = coordinates.GetCoordinateInDirection(direction, 1);
-		if (pieceTargetCoordinate.IsPerimeter()) {
-			// The piece is about to exit the board
-			return c_PieceAboutToExitMultiplier;
-		}
-		
-		if (pieceTargetCoordinate.IsCenter()) {
-			// The piece just entered the center lane and wants to move to the center
-			return c_FreshCenterLanePieceMultiplier;
-		}
-		return 1.f;
-	}
-
 	Score GameResultToScore(Game::PlayerId playerId, Game::GameResult result) {
 		switch (result) {
 		case Game::GameResult::PLAYER_ONE_WINS:
@@ -58,26 +23,26 @@ namespace Alphalcazar::Strategy::MinMax {
 	}
 
 	Score EvaluateBoard(Game::PlayerId playerId, const Game::Game& game) {
+		const Game::Board& board = game.GetBoard();
+		if (board.GetPieceScoreTable() == &c_PieceScoreTable) {
+			// The board has kept the sum of the piece scores up to date as pieces moved, so we don't need to loop over them
+			const Score playerOneScore = board.GetAccumulatedPieceScore();
+			return playerId == Game::PlayerId::PLAYER_ONE ? playerOneScore : -playerOneScore;
+		}
+
 		Score totalScore = 0;
-		auto [pieces, piecesCount] = game.GetBoard().GetPieces();
+		auto [pieces, piecesCount] = board.GetPieces();
 		for (std::size_t i = 0; i < piecesCount; ++i) {
 			auto& [coordinates, piece] = pieces[i];
-			if (!coordinates.IsPerimeter()) {
-				const Game::Direction direction = piece.GetMovementDirection();
-				const float pieceScoreMultiplier = GetPieceScoreMultiplier(coordinates, direction);
-
-				// The piece on board score array stores all piece types in order, meaning that
-				// the score of a certain piece type will be located at index (type - 1)
-				const Score pieceOnBoardScore = c_PieceOnBoardScores[piece.GetType() - 1];
-				const Score pieceScore = static_cast<Score>(pieceOnBoardScore * pieceScoreMultiplier);
+			// Pieces on the perimeter have a score of 0 in the table, so they don't need to be skipped
+			const Score pieceScore = c_PieceScoreTable[Game::GetPieceScoreTableIndex(coordinates, piece.GetMovementDirection(), piece.GetType())];
 
-				// Add the score if the piece belongs to the player for which we are evaluating the score
-				// or subtract it if it belongs to the opponent
-				if (piece.GetOwner() == playerId) {
-					totalScore += pieceScore;
-				} else {
-					totalScore -= pieceScore;
-				}
+			// Add the score if the piece belongs to the player for which we are evaluating the score
+			// or subtract it if it belongs to the opponent
+			if (piece.GetOwner() == playerId) {
+				totalScore += pieceScore;
+			} else {
+				totalScore -= pieceScore;
 			}
 		}
 		return totalScore;
@@ -1,5 +1,6 @@
 #include "minmax/LegalMovements.hpp"
 #include "minmax/config.hpp"
+#include "minmax/EvaluationTables.hpp"
 
 #include <game/Board.hpp>
 #include <game/Piece.hpp>
@@ -33,17 +34,10 @@ namespace Alphalcazar::Strategy::MinMax {
 		return std::make_pair(xSymmetry, ySymmetry);
 	}
 
-	/*!
-	 * \brief Returns an heuristic approximation of the score we expect to gain from a given placement move, for sorting purposes
-	 *
-	 * \param move The move for which to calculate the heuristic approximation.
-	 * \param board The board of the game for which the legal movement is valid.
-	 * \param opponentBoardPieceCount Amount of pieces the opponent has on the board (excluding perimeter)
-	 */
-	Score GetHeuristicPlacementMoveScore(const ScoredPlacementMove& move, const Game::Board& board, const std::size_t opponentBoardPieceCount) {
-		// First, we check if we have good reason to believe that the movement would result in the placed
+	bool IsPlacementBlocked(const Game::PlacementMove& move, const Game::Board& board) {
+		// We check if we have good reason to believe that the movement would result in the placed
 		// piece not even entering the board. While this can be beneficial in some very specific situations,
-		// most times it would just be a blunder, so it makes sense to assign these movements the lowest score
+		// most times it would just be a blunder.
 		if (move.PieceType != Game::c_PusherPieceType) {
 			const auto placementDirection = move.Coordinates.GetLegalPlacementDirection();
 			const auto pieceTargetCoordinate = move.Coordinates.GetCoordinateInDirection(placementDirection, 1);
@@ -57,40 +51,41 @@ namespace Alphalcazar::Strategy::MinMax {
 					const auto blockingPieceTargetCoordinate = pieceTargetCoordinate.GetCoordinateInDirection(pieceTargetTilePiece.GetMovementDirection(), 1);
 					// We check if the target piece moves after us, or if it will attempt to move to the position where we have placed
 					// the piece, causing its movement to be blocked
-					if (pieceTargetTilePiece.GetType() > move.PieceType || blockingPieceTargetCoordinate == move.Coordinates) {
-						return 0;
-					}
+					return pieceTargetTilePiece.GetType() > move.PieceType || blockingPieceTargetCoordinate == move.Coordinates;
 				}
 			}
 		}
+		return false;
+	}
 
-		// Once we assume that the piece will be able to enter the board, we use the heuristic score of the piece
-		// as a base value for the final heuristic score
-		Score resultScore = c_PieceOnBoardScores[move.PieceType - 1];
+	Score GetUnblockedPlacementMoveScore(const Game::PlacementMove& move, std::size_t opponentBoardPieceCount) {
+		// Once we assume that the piece will be able to enter the board, the score only depends on the placement
+		// tile, the piece type and the opponent's piece count, so it has been precomputed. See \ref BuildPlacementMoveScoreTable
+		return c_PlacementMoveScoreTable[GetPlacementMoveScoreTableIndex(move.Coordinates, move.PieceType, opponentBoardPieceCount)];
+	}
 
-		// Check the docstring for \ref c_PusherBonusPerOpponentPiece for more information
-		if (move.PieceType == Game::c_PusherPieceType && opponentBoardPieceCount >= 2) {
-			resultScore += static_cast<Score>(c_PusherBonusPerOpponentPiece * opponentBoardPieceCount);
+	Score GetHeuristicPlacementMoveScore(const Game::PlacementMove& move, const Game::Board& board, std::size_t opponentBoardPieceCount) {
+		// Blocked placements get the lowest score
+		if (IsPlacementBlocked(move, board)) {
+			return 0;
 		}
+		return GetUnblockedPlacementMoveScore(move, opponentBoardPieceCount);
+	}
 
-		// We adjust the score based on if the piece is on the center lane (more valuable) or a lateral lane.
-		// We multiply the positive scores and divide the negative scores by the multiplier, as a higher lane multiplier
-		// is meant to always increase the absolute value of the move score
-		if (move.Coordinates.IsOnCenterLane()) {
-			if (resultScore >= 0) {
-				resultScore = static_cast<Score>(resultScore * c_FreshCenterLanePieceMultiplier);
-			} else {
-				resultScore = static_cast<Score>(resultScore / c_FreshCenterLanePieceMultiplier);
-			}
-		} else {
-			if (resultScore >= 0) {
-				resultScore = static_cast<Score>(resultScore * c_FreshCornerPieceMultiplier);
-			} else {
-				resultScore = static_cast<Score>(resultScore / c_FreshCornerPieceMultiplier);
-			}
+	bool IsSymmetricalPlacement(const Game::Coordinates& coordinates, bool xSymmetry, bool ySymmetry) {
+		if (xSymmetry && ySymmetry) {
+			// If the board has both x and y symmetry, it must be empty
+			// On an empty board, there are really only 2 different tiles on which to play : center or corner
+			// We simply select an arbitrary center tile and an arbitrary corner tile: (4, 2) and (4, 3)
+			return coordinates.x != 4 || (coordinates.y != 3 && coordinates.y != 2);
 		}
-
-		return resultScore;
+		if (xSymmetry) {
+			return coordinates.y < Game::c_CenterCoordinate;
+		}
+		if (ySymmetry) {
+			return coordinates.x < Game::c_CenterCoordinate;
+		}
+		return false;
 	}
 
 	Utils::StaticVector<ScoredPlacementMove, Game::c_MaxLegalMovesCount> SortAndFilterMovements(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Board& board) {
@@ -102,37 +97,12 @@ namespace Alphalcazar::Strategy::MinMax {
 
 		// We build a list of \ref ScoredPlacementMove by looping through the legal moves, removing
 		// symmetrical moves and calculating their heuristic score (which will later be used to sort the list)
-		if (!xSymmetry && !ySymmetry) {
-			// If there are no symmetries on the board, build a list with all moves
-			for (const auto& legalMove : legalMoves) {
-				ScoredPlacementMove move{legalMove};
+		for (const auto& legalMove : legalMoves) {
+			if (!IsSymmetricalPlacement(legalMove.Coordinates, xSymmetry, ySymmetry)) {
+				ScoredPlacementMove move{ legalMove };
 				move.Score = GetHeuristicPlacementMoveScore(move, board, opponentBoardPieceCount);
 				result.insert(move);
 			}
-		} else {
-			// Else, only insert and calculate the score for non-symmetrical moves
-			for (const auto& legalMove : legalMoves) {
-				ScoredPlacementMove move{legalMove};
-				if (xSymmetry && ySymmetry) {
-					// If the board has both x and y symmetry, it must be empty
-					// On an empty board, there are really only 2 different tiles on which to play : center or corner
-					// We simply select an arbitrary center tile and an arbitrary corner tile: (4, 2) and (4, 3)
-					if (move.Coordinates.x == 4 && (move.Coordinates.y == 3 || move.Coordinates.y == 2)) {
-						move.Score = GetHeuristicPlacementMoveScore(move, board, opponentBoardPieceCount);
-						result.insert(move);
-					}
-				} else if (xSymmetry) {
-					if (move.Coordinates.y >= Game::c_CenterCoordinate) {
-						move.Score = GetHeuristicPlacementMoveScore(move, board, opponentBoardPieceCount);
-						result.insert(move);
-					}
-				} else if (ySymmetry) {
-					if (move.Coordinates.x >= Game::c_CenterCoordinate) {
-						move.Score = GetHeuristicPlacementMoveScore(move, board, opponentBoardPieceCount);
-						result.insert(move);
-					}
-				}
-			}
 		}
 
 		// Sort the list by the heuristic score of the placement moves
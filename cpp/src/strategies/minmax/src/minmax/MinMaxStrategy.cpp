@@ -1,162 +1,709 @@
 #include "minmax/MinMaxStrategy.hpp"
 
 #include "minmax/BoardEvaluation.hpp"
+#include "minmax/EvaluationTables.hpp"
 #include "minmax/LegalMovements.hpp"
+#include "minmax/MovePicker.hpp"
+#include "minmax/NeuralEvaluation.hpp"
+#include "minmax/SearchContext.hpp"
+#include "minmax/Tactics.hpp"
 #include "minmax/config.hpp"
 
 #include <game/Game.hpp>
 #include <game/PlacementMove.hpp>
 #include <util/Log.hpp>
+#include "util/TaskLatch.hpp"
 #include "util/ThreadPool.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+
 namespace Alphalcazar::Strategy::MinMax {
 	/// The initial value of the "alpha" parameter of the minmax algorithm
 	constexpr Score c_AlphaStartingValue = -c_WinConditionScore * 10;
 	/// The initial value of the "beta" parameter of the minmax algorithm
 	constexpr Score c_BetaStartingValue = c_WinConditionScore * 10;
 
-	MinMaxStrategy::MinMaxStrategy(const Depth depth, bool multithreaded)
+	/// A root move searched by a \ref MinMaxStrategy::PendingSearch
+	struct SearchedRootMove {
+		AnalyzedMove Move;
+		/*!
+		 * \brief Whether the score of the move is only an upper bound of its exact score, because its search failed low:
+		 *        the move scored no better than the alpha it was searched with.
+		 */
+		bool UpperBound = false;
+	};
+
+	/*!
+	 * \brief Plays the specified move on the game and, if it completed a turn, fast-forwards the game through the
+	 *        following turns in which neither player can place a piece (see \ref Game::Game::FastForward).
+	 *
+	 * \param fastForwardedTurns Receives the amount of turns that were fast-forwarded.
+	 * \returns The result of the game after playing the move.
+	 */
+	Game::GameResult PlaySearchMove(Game::Game& game, const Game::PlacementMove& move, Depth& fastForwardedTurns) {
+		auto result = game.PlayNextPlacementMove(move);
+		fastForwardedTurns = 0;
+		if (result == Game::GameResult::NONE && !game.GetState().FirstMoveExecuted) {
+			// Turns in which neither player can place a piece are deterministic, so we resolve them
+			// right away instead of spending search depth on them
+			const auto turnBeforeFastForward = game.GetState().Turn;
+			result = game.FastForward();
+			fastForwardedTurns = static_cast<Depth>(std::min<std::uint16_t>(game.GetState().Turn - turnBeforeFastForward, std::numeric_limits<Depth>::max() - 1));
+		}
+		return result;
+	}
+
+	/// Returns the score of the worst of the best scores (or moves) kept so far, or the starting alpha if there are not enough of them yet
+	Score GetWorstBestScore(const std::vector<Score>& bestScores, std::size_t moveCount) {
+		return bestScores.size() < moveCount ? c_AlphaStartingValue : bestScores.back();
+	}
+
+	Score GetWorstBestScore(const std::vector<SearchedRootMove>& bestMoves, std::size_t moveCount) {
+		return bestMoves.size() < moveCount ? c_AlphaStartingValue : bestMoves.back().Move.Score;
+	}
+
+	/*!
+	 * \brief Inserts a score into the best scores kept so far (sorted from best to worst), if it is better than the worst of them
+	 *        or there are fewer than \p moveCount of them. Returns whether the score was inserted.
+	 *
+	 * Only exact scores may be inserted, as the worst of the best scores is the alpha of the next root moves.
+	 */
+	bool InsertBestScore(std::vector<Score>& bestScores, Score score, std::size_t moveCount) {
+		if (bestScores.size() >= moveCount && score <= bestScores.back()) {
+			return false;
+		}
+		bestScores.insert(std::upper_bound(bestScores.begin(), bestScores.end(), score, std::greater<Score>{}), score);
+		if (bestScores.size() > moveCount) {
+			bestScores.pop_back();
+		}
+		return true;
+	}
+
+	/// Returns whether a searched root move ranks before another: it has a better score, or the same one but an exact one
+	bool IsBetterRootMove(const SearchedRootMove& move, const SearchedRootMove& otherMove) {
+		if (move.Move.Score != otherMove.Move.Score) {
+			return move.Move.Score > otherMove.Move.Score;
+		}
+		return !move.UpperBound && otherMove.UpperBound;
+	}
+
+	/*!
+	 * \brief Same as \ref InsertBestScore, for the best moves. Moves that rank the same (see \ref IsBetterRootMove) are kept
+	 *        in the order they were inserted.
+	 *
+	 * A move whose score is only an upper bound never displaces a move with the same exact score, since its exact score
+	 * may be lower. It is only kept while there are fewer than \p moveCount moves with better or exact scores.
+	 */
+	void InsertBestMove(std::vector<SearchedRootMove>& bestMoves, SearchedRootMove&& move, std::size_t moveCount) {
+		if (bestMoves.size() >= moveCount && !IsBetterRootMove(move, bestMoves.back())) {
+			return;
+		}
+		const auto position = std::upper_bound(bestMoves.begin(), bestMoves.end(), move, IsBetterRootMove);
+		bestMoves.insert(position, std::move(move));
+		if (bestMoves.size() > moveCount) {
+			bestMoves.pop_back();
+		}
+	}
+
+	/*!
+	 * \brief Collects the positions in which the player is expected to play their next move, starting from the specified game,
+	 *        see \ref PonderMode.
+	 *
+	 * \param variation The moves the last search expects to be played, see \ref AnalyzedMove::PrincipalVariation.
+	 * \param variationIndex The index of the next move of the variation, or the size of the variation if the game left it.
+	 * \param allReplies Whether all the legal moves of the next opponent move are followed, instead of only the predicted one.
+	 */
+	void CollectPonderPositions(Game::PlayerId playerId, Game::Game game, const std::vector<Game::PlacementMove>& variation, std::size_t variationIndex, bool allReplies, std::vector<Game::Game>& positions) {
+		while (true) {
+			if (!game.GetState().FirstMoveExecuted && game.FastForward() != Game::GameResult::NONE) {
+				return;
+			}
+			const Game::PlayerId activePlayerId = game.GetActivePlayer();
+			const auto legalMoves = game.GetLegalMoves(activePlayerId);
+			if (activePlayerId == playerId && !legalMoves.empty()) {
+				const auto hash = game.GetHash();
+				if (std::none_of(positions.begin(), positions.end(), [hash](const Game::Game& position) { return position.GetHash() == hash; })) {
+					positions.push_back(game);
+				}
+				return;
+			}
+
+			// The opponent plays, or any player without legal moves passes
+			Game::PlacementMove predictedMove {};
+			if (!legalMoves.empty()) {
+				if (variationIndex < variation.size() && std::find(legalMoves.begin(), legalMoves.end(), variation[variationIndex]) != legalMoves.end()) {
+					predictedMove = variation[variationIndex];
+				} else {
+					variationIndex = variation.size();
+					predictedMove = SortAndFilterMovements(activePlayerId, legalMoves, game.GetBoard())[0];
+				}
+			}
+
+			if (allReplies && !legalMoves.empty()) {
+				// The predicted reply goes first, as it is the most likely one to be played
+				Game::Game predictedGame = game;
+				if (predictedGame.PlayNextPlacementMove(predictedMove) == Game::GameResult::NONE) {
+					CollectPonderPositions(playerId, predictedGame, variation, variationIndex + 1, false, positions);
+				}
+				for (const auto& move : legalMoves) {
+					Game::Game replyGame = game;
+					if (!(move == predictedMove) && replyGame.PlayNextPlacementMove(move) == Game::GameResult::NONE) {
+						CollectPonderPositions(playerId, replyGame, variation, variation.size(), false, positions);
+					}
+				}
+				return;
+			}
+
+			if (game.PlayNextPlacementMove(predictedMove) != Game::GameResult::NONE) {
+				return;
+			}
+			variationIndex = std::min(variationIndex + 1, variation.size());
+		}
+	}
+
+	/// Adds the statistics of a thread of a search to the ones of the search, once the thread returns (see \ref c_CollectSearchStatistics)
+	void MergeSearchStatistics(const SearchContext& context) {
+		context.State->Statistics.Merge(context.Statistics);
+	}
+
+	/// Puts the root moves of the statistics of a search in the order of its candidate moves, as its threads may have finished them in any order
+	void SortRootMoves(SearchStatistics& statistics, const Utils::StaticVector<ScoredPlacementMove, Game::c_MaxLegalMovesCount>& candidateMoves) {
+		const auto getCandidateIndex = [&candidateMoves](const RootMoveStatistics& rootMove) {
+			return std::find(candidateMoves.begin(), candidateMoves.end(), rootMove.Move) - candidateMoves.begin();
+		};
+		std::sort(statistics.RootMoves.begin(), statistics.RootMoves.end(), [&getCandidateIndex](const RootMoveStatistics& a, const RootMoveStatistics& b) {
+			return getCandidateIndex(a) < getCandidateIndex(b);
+		});
+	}
+
+	void SortRootMoves(NoSearchStatistics&, const Utils::StaticVector<ScoredPlacementMove, Game::c_MaxLegalMovesCount>&) {}
+
+	/// Returns the statistics collected by a search, or empty ones if they are not collected
+	const SearchStatistics& GetSearchStatistics(const SearchStatistics& statistics) {
+		return statistics;
+	}
+
+	const SearchStatistics& GetSearchStatistics(const NoSearchStatistics&) {
+		static const SearchStatistics s_EmptyStatistics;
+		return s_EmptyStatistics;
+	}
+
+	struct MinMaxStrategy::PendingSearch {
+		/// The player executing the search
+		Game::PlayerId Player = Game::PlayerId::NONE;
+		/// The position being searched, with the piece score table set on its board
+		Game::Game Position;
+		/// The root moves to search
+		Utils::StaticVector<ScoredPlacementMove, Game::c_MaxLegalMovesCount> CandidateMoves;
+		/// The amount of best moves to return
+		std::size_t MoveCount = 1;
+		/// Whether the principal variation of the best moves is collected
+		bool CollectPrincipalVariations = false;
+		/// A move that wins this turn, found without searching. No other move is searched if set.
+		std::optional<Game::PlacementMove> WinningMove;
+		/// The state shared by the threads of the search
+		SearchState State;
+		/// The results of the candidate moves being searched on the thread pool, or empty if the search is not asynchronous
+		std::vector<SearchedRootMove> MoveResults;
+		/// The index of the next candidate move to be searched on the thread pool
+		std::atomic<std::size_t> NextMoveIndex = 0;
+		/// The priority of the tasks of the search on the thread pool, raised once a background search is taken over by a live one
+		std::atomic<Utils::TaskPriority> Priority = Utils::TaskPriority::NORMAL;
+		/// Counts the tasks still searching candidate moves on the thread pool
+		Utils::TaskLatch MovesSearched;
+	};
+
+	MinMaxStrategy::MinMaxStrategy(const Depth depth, bool multithreaded, const MinMaxOptions& options)
 		: mDepth { depth }
 		, mMultithreaded { multithreaded }
+		, mOptions { options }
 	{
-		if (mMultithreaded) {
+		if (mMultithreaded || mOptions.Ponder != PonderMode::NONE) {
 			/*
 			 * Alpha-beta-pruning works best when all branches are calculated sequentially. However,
 			 * we want to make use of all cores of the machine we are running on. To maximise alpha-beta-cutoffs while
-			 * making sure we make the most use of the cores of our current hardware, we create a thread pool with as
-			 * many threads as the maximum supported hardware concurrency (minus 1, for the main thread).
-			 *
-			 * We always want to have at least 1 worker thread to ensure that single-core machines still execute this strategy.
+			 * making sure we make the most use of the cores of our current hardware, the root moves are searched in parallel
+			 * on a thread pool, by default the one shared by the whole process (so that several strategies don't oversubscribe
+			 * the cores), with the thread waiting for the search helping too.
 			 */
-			std::size_t threadCount = std::max(std::thread::hardware_concurrency() - 1, 1U);
-			mThreadPool = std::make_unique<Utils::ThreadPool>(threadCount);
+			mThreadPool = mOptions.ThreadPool ? mOptions.ThreadPool : &Utils::ThreadPool::GetShared();
 		}
 	}
 
-	MinMaxStrategy::~MinMaxStrategy() = default;
+	MinMaxStrategy::~MinMaxStrategy() {
+		// The background searches use the strategy and its thread pool, so they must return before they are destroyed
+		StopPondering();
+	}
 
 	Game::PlacementMove MinMaxStrategy::Execute(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game) {
-		auto candidateMoves =  SortAndFilterMovements(playerId, legalMoves, game.GetBoard());
+		return ExecuteStoppable(playerId, legalMoves, game, Utils::StopToken{});
+	}
+
+	Game::PlacementMove MinMaxStrategy::ExecuteStoppable(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game, const Utils::StopToken& stopToken) {
+		std::unique_ptr<PendingSearch> search = TakePonderedSearch(playerId, legalMoves, game);
+		mLastExecutedMovePondered = search != nullptr;
+		if (search) {
+			Utils::LogDebug("Player {} found the position in the background searches.", static_cast<std::size_t>(playerId));
+		} else {
+			search = StartExecuteSearch(playerId, legalMoves, game, mMultithreaded, stopToken);
+		}
+
+		const AnalyzedMove bestMove = FinishSearch(*search, stopToken).front();
+		mLastExecutedMoveScore = bestMove.Score;
+		if (search->WinningMove) {
+			Utils::LogDebug("Player {} played winning move {}.", static_cast<std::size_t>(playerId), bestMove.Move);
+		} else {
+			const auto& candidateMoves = search->CandidateMoves;
+			const auto bestMoveIndex = static_cast<std::size_t>(std::find(candidateMoves.begin(), candidateMoves.end(), bestMove.Move) - candidateMoves.begin());
+			Utils::LogDebug("Player {} played {} (idx {}/{}) with score {}.", static_cast<std::size_t>(playerId), bestMove.Move, bestMoveIndex, candidateMoves.size(), bestMove.Score);
+		}
+
+		// A stopped search is usually abandoned, so there is no point in pondering on its move
+		if (mOptions.Ponder != PonderMode::NONE && !stopToken.StopRequested()) {
+			StartPondering(playerId, bestMove, game);
+		}
+		return bestMove.Move;
+	}
+
+	std::vector<AnalyzedMove> MinMaxStrategy::Analyze(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& rootGame, std::size_t moveCount) {
+		Game::Game game = rootGame;
+		game.GetBoard().SetPieceScoreTable(&c_PieceScoreTable);
+		if (mOptions.Network) {
+			game.GetBoard().SetPieceFeatureTable(&mOptions.Network->FirstLayerWeights);
+		}
 
+		const auto candidateMoves = SortAndFilterMovements(playerId, legalMoves, game.GetBoard());
 		assert(!candidateMoves.empty());
-		Score bestScore = c_AlphaStartingValue;
-		std::size_t bestMoveIndex = 0;
-		if (mMultithreaded) {
-			mFirstLevelAlpha = c_AlphaStartingValue;
-
-			using MoveFutureResult = std::pair<Score, Game::PlacementMove>;
-			std::vector<std::future<MoveFutureResult>> moveFutures;
-			moveFutures.reserve(candidateMoves.size());
-			for (const auto& move : candidateMoves) {
-				auto moveFuture = mThreadPool->Execute([this, playerId, move, game]() -> MoveFutureResult {
-					const auto moveScore = GetNextBestScore(playerId, move, mDepth, game, mFirstLevelAlpha, c_BetaStartingValue);
-					mFirstLevelAlpha = std::max(mFirstLevelAlpha.load(), moveScore);
-					return std::make_pair(moveScore, move);
-				});
-				moveFutures.emplace_back(std::move(moveFuture));
-			}
-
-			for (auto& moveFuture : moveFutures) {
-				moveFuture.wait();
-			}
-
-			for (std::size_t i = 0; i < moveFutures.size(); i++) {
-				auto& moveFuture = moveFutures[i];
-				const MoveFutureResult moveFutureResult = moveFuture.get();
-				if (moveFutureResult.first > bestScore) {
-					bestScore = moveFutureResult.first;
-					bestMoveIndex = i;
+		const Utils::StopToken stopToken;
+		return FinishSearch(*StartSearch(playerId, candidateMoves, game, std::max<std::size_t>(moveCount, 1), true, mMultithreaded, stopToken), stopToken);
+	}
+
+	std::unique_ptr<MinMaxStrategy::PendingSearch> MinMaxStrategy::StartSearch(Game::PlayerId playerId, const Utils::StaticVector<ScoredPlacementMove, Game::c_MaxLegalMovesCount>& candidateMoves, const Game::Game& game, std::size_t moveCount, bool collectPrincipalVariations, bool async, const Utils::StopToken& stopToken) {
+		auto search = std::make_unique<PendingSearch>();
+		search->State.StopToken = stopToken;
+		search->Player = playerId;
+		search->Position = game;
+		search->CandidateMoves = candidateMoves;
+		search->MoveCount = moveCount;
+		search->CollectPrincipalVariations = collectPrincipalVariations;
+		search->State.RootAlpha = c_AlphaStartingValue;
+		search->State.BestScores.reserve(moveCount + 1);
+		search->State.Statistics.Start();
+		if (!async) {
+			return search;
+		}
+
+		search->Priority = Utils::TaskPriorityScope::GetCurrent();
+		search->MoveResults.resize(candidateMoves.size());
+		QueueCandidateMovesSearches(*search);
+		return search;
+	}
+
+	std::unique_ptr<MinMaxStrategy::PendingSearch> MinMaxStrategy::StartExecuteSearch(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& rootGame, bool async, const Utils::StopToken& stopToken) {
+		// Let the board keep the piece scores (and the first layer of the network) up to date as the search plays moves, so that
+		// every copy of it made below this point can be evaluated without looping over its pieces (see \ref EvaluateBoard)
+		Game::Game game = rootGame;
+		game.GetBoard().SetPieceScoreTable(&c_PieceScoreTable);
+		if (mOptions.Network) {
+			game.GetBoard().SetPieceFeatureTable(&mOptions.Network->FirstLayerWeights);
+		}
+
+		auto candidateMoves =  SortAndFilterMovements(playerId, legalMoves, game.GetBoard());
+		assert(!candidateMoves.empty());
+
+		// Moves that decide the game at the end of this turn are found without searching. A win is played right away,
+		// and moves that let the opponent win are always worse than any other move, so they are only searched if every move does.
+		const auto tacticalOutcomes = GetTacticalOutcomes(playerId, candidateMoves, game);
+		bool allMovesLose = true;
+		for (std::size_t i = 0; i < candidateMoves.size(); i++) {
+			if (tacticalOutcomes[i] == TacticalOutcome::WIN) {
+				auto search = std::make_unique<PendingSearch>();
+				search->Player = playerId;
+				search->Position = game;
+				search->WinningMove = candidateMoves[i];
+				return search;
+			}
+			allMovesLose &= tacticalOutcomes[i] == TacticalOutcome::LOSS;
+		}
+		if (!allMovesLose) {
+			Utils::StaticVector<ScoredPlacementMove, Game::c_MaxLegalMovesCount> safeMoves;
+			for (std::size_t i = 0; i < candidateMoves.size(); i++) {
+				if (tacticalOutcomes[i] != TacticalOutcome::LOSS) {
+					safeMoves.insert(candidateMoves[i]);
 				}
 			}
+			candidateMoves = safeMoves;
+		}
+
+		// The principal variation predicts the replies of the opponent to ponder on
+		const bool collectPrincipalVariations = mOptions.Ponder == PonderMode::PREDICTED_REPLY;
+		return StartSearch(playerId, candidateMoves, game, 1, collectPrincipalVariations, async, stopToken);
+	}
+
+	std::vector<AnalyzedMove> MinMaxStrategy::FinishSearch(PendingSearch& search, const Utils::StopToken& stopToken) {
+		if (search.WinningMove) {
+			mLastSearchStatistics = {};
+			return { AnalyzedMove { *search.WinningMove, c_WinConditionScore, { *search.WinningMove } } };
+		}
+
+		SearchContext context = CreateSearchContext(search.Position, search.CollectPrincipalVariations, search.State);
+		std::vector<SearchedRootMove> bestMoves;
+		bestMoves.reserve(search.MoveCount + 1);
+		const auto insertSearchedMove = [this, &bestMoves, &search, &context](SearchedRootMove&& move) {
+			if (!move.Move.Move.Valid()) {
+				return;
+			}
+			if (move.UpperBound && move.Move.Score >= GetWorstBestScore(bestMoves, search.MoveCount)) {
+				// The bound ties the worst move kept so far (or the list is not full yet), so the move is searched again just
+				// below its bound: it either reaches the bound, which is then its exact score, or falls below it
+				const Score alpha = move.Move.Score - 1;
+				AnalyzedMove researchedMove = SearchRootMove(search.Player, move.Move.Move, search.Position, alpha, context);
+				if (researchedMove.Move.Valid()) {
+					const bool upperBound = researchedMove.Score <= alpha;
+					move = { std::move(researchedMove), upperBound };
+				}
+			}
+			InsertBestMove(bestMoves, std::move(move), search.MoveCount);
+		};
+		if (!search.MoveResults.empty()) {
+			if (!(search.State.StopToken == stopToken)) {
+				// The search was started with another token (see \ref TakePonderedSearch), so it also stops with this one
+				search.State.StopToken.Follow(stopToken);
+			}
+			// The calling thread searches the candidate moves no worker thread has picked up yet
+			mThreadPool->Wait(search.MovesSearched);
+			// Every task is done, so the nodes of the moves searched again below must not raise their alpha to the root alpha
+			search.State.RootAlpha = c_AlphaStartingValue;
+
+			// The moves are kept in the order of the candidate moves, so that ties are broken the same way as without threads
+			for (auto& moveResult : search.MoveResults) {
+				insertSearchedMove(std::move(moveResult));
+			}
+			search.MoveResults.clear();
 		} else {
-			Score alpha = c_AlphaStartingValue;
-			for (std::size_t i = 0; i < candidateMoves.size(); ++i) {
-				auto& move = candidateMoves[i];
-				const auto moveScore = GetNextBestScore(playerId, move, mDepth, game, alpha, c_BetaStartingValue);
-				if (moveScore > bestScore) {
-					bestScore = moveScore;
-					alpha = moveScore;
-					bestMoveIndex = i;
+			for (const auto& move : search.CandidateMoves) {
+				const Score alpha = GetWorstBestScore(bestMoves, search.MoveCount);
+				AnalyzedMove analyzedMove = SearchRootMove(search.Player, move, search.Position, alpha, context);
+				const bool upperBound = analyzedMove.Score <= alpha;
+				insertSearchedMove({ std::move(analyzedMove), upperBound });
+				if (search.State.StopToken.StopRequested()) {
+					break;
+				}
+			}
+		}
+		MergeSearchStatistics(context);
+
+		mLastSearchStatistics = search.State.Statistics.Finish();
+		SortRootMoves(mLastSearchStatistics, search.CandidateMoves);
+
+		if (bestMoves.empty()) {
+			// The search was stopped before any move was searched completely, so the best move is only known from the heuristics
+			const Game::PlacementMove& move = search.CandidateMoves[0];
+			return { AnalyzedMove { move, 0, { move } } };
+		}
+		std::vector<AnalyzedMove> result;
+		result.reserve(bestMoves.size());
+		for (auto& bestMove : bestMoves) {
+			result.push_back(std::move(bestMove.Move));
+		}
+		return result;
+	}
+
+	void MinMaxStrategy::QueueCandidateMovesSearches(PendingSearch& search) {
+		// Every task searches the candidate moves no other task has started yet, in order, so that at most MaxThreads
+		// threads search this position at once
+		const std::size_t maxThreads = mOptions.MaxThreads > 0 ? mOptions.MaxThreads : mThreadPool->GetThreadCount() + 1;
+		const std::size_t remainingMoveCount = search.CandidateMoves.size() - std::min(search.NextMoveIndex.load(), search.CandidateMoves.size());
+		const std::size_t taskCount = std::min(maxThreads, remainingMoveCount);
+		for (std::size_t i = 0; i < taskCount; i++) {
+			QueueCandidateMovesSearch(search);
+		}
+	}
+
+	void MinMaxStrategy::QueueCandidateMovesSearch(PendingSearch& search) {
+		// The search outlives its tasks, as it always waits for them before being destroyed
+		mThreadPool->Execute([this, &search]() {
+			SearchCandidateMoves(search);
+		}, search.MovesSearched, search.State.StopToken);
+	}
+
+	void MinMaxStrategy::SearchCandidateMoves(PendingSearch& search) {
+		SearchContext context = CreateSearchContext(search.Position, search.CollectPrincipalVariations, search.State);
+		std::size_t moveIndex = search.NextMoveIndex++;
+		while (moveIndex < search.CandidateMoves.size() && !search.State.StopToken.StopRequested()) {
+			AnalyzedMove analyzedMove = SearchRootMove(search.Player, search.CandidateMoves[moveIndex], search.Position, search.State.RootAlpha, context);
+			// The search raises its alpha as other threads find better root moves, up to the root alpha once it returns
+			const bool upperBound = analyzedMove.Score <= search.State.RootAlpha;
+			if (analyzedMove.Move.Valid() && !upperBound) {
+				std::lock_guard<std::mutex> lock { search.State.BestScoresMutex };
+				if (InsertBestScore(search.State.BestScores, analyzedMove.Score, search.MoveCount)) {
+					search.State.RootAlpha = std::max(search.State.RootAlpha.load(), GetWorstBestScore(search.State.BestScores, search.MoveCount));
 				}
 			}
+			search.MoveResults[moveIndex] = { std::move(analyzedMove), upperBound };
+
+			if (search.Priority != Utils::TaskPriorityScope::GetCurrent()) {
+				// The search was taken over by a caller of another priority, which queued its own tasks (see \ref TakePonderedSearch)
+				break;
+			}
+			if (search.NextMoveIndex < search.CandidateMoves.size() && mThreadPool->ShouldYield()) {
+				MergeSearchStatistics(context);
+				QueueCandidateMovesSearch(search);
+				return;
+			}
+			moveIndex = search.NextMoveIndex++;
+		}
+		MergeSearchStatistics(context);
+	}
+
+	AnalyzedMove MinMaxStrategy::SearchRootMove(Game::PlayerId playerId, const Game::PlacementMove& move, const Game::Game& game, Score alpha, SearchContext& context) {
+		std::chrono::steady_clock::time_point startTime;
+		std::uint64_t startNodes = 0;
+		if constexpr (c_CollectSearchStatistics) {
+			startTime = std::chrono::steady_clock::now();
+			startNodes = context.Statistics.GetNodes();
+		}
+		AnalyzedMove analyzedMove { move, GetNextBestScore(playerId, move, mDepth, game, alpha, c_BetaStartingValue, context), {} };
+		if (context.State->StopToken.StopRequested()) {
+			return {};
+		}
+		if constexpr (c_CollectSearchStatistics) {
+			context.Statistics.AddRootMove(RootMoveStatistics { move, context.Statistics.GetNodes() - startNodes, std::chrono::steady_clock::now() - startTime });
+		}
+		if (context.PrincipalVariations.IsEnabled()) {
+			// The principal variation of the move is the move itself followed by the line of the next ply
+			context.PrincipalVariations.Update(context.Ply, move);
+			analyzedMove.PrincipalVariation = context.PrincipalVariations.GetLine(context.Ply);
+		}
+		return analyzedMove;
+	}
+
+	void MinMaxStrategy::StartPondering(Game::PlayerId playerId, const AnalyzedMove& playedMove, const Game::Game& game) {
+		Game::Game gameAfterMove = game;
+		if (gameAfterMove.PlayNextPlacementMove(playedMove.Move) != Game::GameResult::NONE) {
+			return;
+		}
+
+		std::vector<Game::Game> positions;
+		CollectPonderPositions(playerId, gameAfterMove, playedMove.PrincipalVariation, 1, mOptions.Ponder == PonderMode::ALL_REPLIES, positions);
+		// The background searches must not delay the live searches sharing the thread pool
+		const Utils::TaskPriorityScope priorityScope { Utils::TaskPriority::BACKGROUND };
+		for (const auto& position : positions) {
+			mPonderedSearches.emplace_back(StartExecuteSearch(playerId, position.GetLegalMoves(playerId), position, true, Utils::StopToken{}));
+		}
+	}
+
+	std::unique_ptr<MinMaxStrategy::PendingSearch> MinMaxStrategy::TakePonderedSearch(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Game& game) {
+		const auto isLegal = [&legalMoves](const Game::PlacementMove& move) {
+			return std::find(legalMoves.begin(), legalMoves.end(), move) != legalMoves.end();
+		};
+		std::unique_ptr<PendingSearch> ponderedSearch;
+		const auto hash = game.GetHash();
+		for (auto& search : mPonderedSearches) {
+			if (ponderedSearch || search->Player != playerId || search->Position.GetHash() != hash) {
+				continue;
+			}
+			// The caller may allow fewer moves than the position has, and another position may share the hash,
+			// so the search is only reused if every move it can return is one of the legal moves
+			const bool movesLegal = search->WinningMove
+				? isLegal(*search->WinningMove)
+				: std::all_of(search->CandidateMoves.begin(), search->CandidateMoves.end(), isLegal);
+			if (movesLegal) {
+				ponderedSearch = std::move(search);
+			}
+		}
+		StopPondering();
+		if (ponderedSearch) {
+			// The rest of the search runs with the priority of the caller. Its queued background tasks would only be picked up
+			// once no normal task is left, so fresh tasks are queued, and the background ones return once they are run.
+			ponderedSearch->Priority = Utils::TaskPriorityScope::GetCurrent();
+			QueueCandidateMovesSearches(*ponderedSearch);
 		}
-		mLastExecutedMoveScore = bestScore;
-		const auto& bestMove = candidateMoves[bestMoveIndex];
-		Utils::LogDebug("Player {} played {} (idx {}/{}) with score {}.", static_cast<std::size_t>(playerId), bestMove, bestMoveIndex, candidateMoves.size(), bestScore);
-		return bestMove;
+		return ponderedSearch;
 	}
 
-	Score MinMaxStrategy::Max(Game::PlayerId playerId, Depth depth, const Game::Game& game, Score alpha, Score beta) {
+	void MinMaxStrategy::StopPondering() {
+		for (auto& search : mPonderedSearches) {
+			if (search) {
+				search->State.StopToken.RequestStop();
+			}
+		}
+		// Helping runs the queued tasks of the stopped searches, which return right away, instead of waiting for a free worker
+		for (auto& search : mPonderedSearches) {
+			if (search) {
+				mThreadPool->Wait(search->MovesSearched);
+			}
+		}
+		mPonderedSearches.clear();
+	}
+
+	Score MinMaxStrategy::Max(Game::PlayerId playerId, Depth depth, const Game::Game& game, Score alpha, Score beta, SearchContext& context) {
 		if (depth == 0) {
-			return EvaluateBoard(playerId, game);
+			return EvaluateLeaf(playerId, game, context);
 		}
 		Score bestScore = c_AlphaStartingValue;
 		// We are in "Max" so we are evaluating the player who is executing the strategy
 		const auto legalMoves = game.GetLegalMoves(playerId);
-		auto candidateMoves = SortAndFilterMovements(playerId, legalMoves, game.GetBoard());
-		for (const auto& move : candidateMoves) {
-			const auto nextBestScore = GetNextBestScore(playerId, move, depth, game, alpha, beta);
-
-			bestScore = std::max(nextBestScore, bestScore);
-			alpha = std::max(bestScore, alpha);
-			if (mMultithreaded) {
-				alpha = std::max(alpha, mFirstLevelAlpha.load());
+		if (legalMoves.empty()) {
+			// The player has no pieces in hand, so they skip their placement move (see \ref Game::ExecutePlayerMove)
+			bestScore = GetNextBestScore(playerId, {}, depth, game, alpha, beta, context);
+			context.PrincipalVariations.Update(context.Ply, {});
+			return bestScore;
+		}
+		MovePicker movePicker { playerId, legalMoves, game.GetBoard() };
+		while (const ScoredPlacementMove* move = movePicker.Next()) {
+			const auto nextBestScore = GetNextBestScore(playerId, *move, depth, game, alpha, beta, context);
+			if (nextBestScore > bestScore) {
+				bestScore = nextBestScore;
+				context.PrincipalVariations.Update(context.Ply, *move);
 			}
+			alpha = std::max(bestScore, alpha);
+			// Other threads of the search may have found better root moves already
+			alpha = std::max(alpha, context.State->RootAlpha.load());
 
 			if (alpha > beta) {
+				context.Statistics.AddCutoff(movePicker.GetHandedOutCount() - 1);
 				break;
 			}
 		}
 		return bestScore;
 	}
 
-	Score MinMaxStrategy::Min(Game::PlayerId playerId, Depth depth, const Game::Game& game, Score alpha, Score beta) {
+	Score MinMaxStrategy::Min(Game::PlayerId playerId, Depth depth, const Game::Game& game, Score alpha, Score beta, SearchContext& context) {
 		if (depth == 0) {
-			return EvaluateBoard(playerId, game);
+			return EvaluateLeaf(playerId, game, context);
 		}
 		Score bestScore = c_BetaStartingValue;
 		// We are in "Min" so we are evaluating the opponent
 		const auto opponentId = playerId == Game::PlayerId::PLAYER_ONE ? Game::PlayerId::PLAYER_TWO : Game::PlayerId::PLAYER_ONE;
 		const auto legalMoves = game.GetLegalMoves(opponentId);
-		auto candidateMoves = SortAndFilterMovements(playerId, legalMoves, game.GetBoard());
-		for (const auto& move : candidateMoves) {
-			const auto nextBestScore = GetNextBestScore(playerId, move, depth, game, alpha, beta);
-			bestScore = std::min(nextBestScore, bestScore);
+		if (legalMoves.empty()) {
+			// The opponent has no pieces in hand, so they skip their placement move (see \ref Game::ExecutePlayerMove)
+			bestScore = GetNextBestScore(playerId, {}, depth, game, alpha, beta, context);
+			context.PrincipalVariations.Update(context.Ply, {});
+			return bestScore;
+		}
+		MovePicker movePicker { playerId, legalMoves, game.GetBoard() };
+		while (const ScoredPlacementMove* move = movePicker.Next()) {
+			const auto nextBestScore = GetNextBestScore(playerId, *move, depth, game, alpha, beta, context);
+			if (nextBestScore < bestScore) {
+				bestScore = nextBestScore;
+				context.PrincipalVariations.Update(context.Ply, *move);
+			}
 			beta = std::min(bestScore, beta);
 			if (beta < alpha) {
+				context.Statistics.AddCutoff(movePicker.GetHandedOutCount() - 1);
 				break;
 			}
 		}
 		return bestScore;
 	}
 
-	Score MinMaxStrategy::GetNextBestScore(Game::PlayerId playerId, const Game::PlacementMove& move, Depth depth, const Game::Game& game, Score alpha, Score beta) {
+	Score MinMaxStrategy::GetNextBestScore(Game::PlayerId playerId, const Game::PlacementMove& move, Depth depth, const Game::Game& game, Score alpha, Score beta, SearchContext& context) {
+		// Looking at the clock on every node would slow the search down, so the deadline is only checked every so often
+		if (++context.VisitedNodes % c_DeadlineCheckInterval == 0) {
+			context.State->StopToken.CheckDeadline();
+		}
+		if (context.State->StopToken.StopRequested()) {
+			// The result of a stopped search is discarded, so there is no point in searching any further
+			return 0;
+		}
+		context.Statistics.AddNode(context.Ply);
+		// The line of the next ply stays empty unless the move is searched deeper
+		context.PrincipalVariations.Clear(context.Ply + 1);
 		Game::Game gameCopy = game;
-		const auto result = gameCopy.PlayNextPlacementMove(move);
+		Depth fastForwardedTurns;
+		const auto result = PlaySearchMove(gameCopy, move, fastForwardedTurns);
+
 		Score nextBestScore;
 		if (result != Game::GameResult::NONE) {
-			nextBestScore = GameResultToScore(playerId, result);
+			nextBestScore = GetDepthAdjustedScore(GameResultToScore(playerId, result), fastForwardedTurns);
 		} else {
 			// Only decrease the depth if this placement move completed a turn
 			// as we want to evaluate complete turns only, never half a turn
-			const Depth nextDepth = gameCopy.GetState().FirstMoveExecuted ? depth : depth - 1;
+			const bool turnCompleted = !gameCopy.GetState().FirstMoveExecuted;
+			const Depth nextDepth = turnCompleted ? depth - 1 : depth;
+			if (turnCompleted) {
+				// Pieces cycle on and off the board, so a position can be reached again along the same line.
+				// Searching it again would only repeat the work done for its first occurrence.
+				const Game::PositionHash hash = gameCopy.GetHash();
+				if (context.IsRepetition(hash)) {
+					context.Statistics.AddRepetition();
+					return GameResultToScore(playerId, Game::GameResult::DRAW);
+				}
+				context.PositionHistory.push_back(hash);
+			}
+
 			const Game::PlayerId activePlayerId = gameCopy.GetActivePlayer();
+			context.Ply++;
 			if (activePlayerId == playerId) {
-				nextBestScore = Max(playerId, nextDepth, gameCopy, alpha, beta);
+				nextBestScore = Max(playerId, nextDepth, gameCopy, alpha, beta, context);
 			} else {
-				nextBestScore = Min(playerId, nextDepth, gameCopy, alpha, beta);
+				nextBestScore = Min(playerId, nextDepth, gameCopy, alpha, beta, context);
+			}
+			context.Ply--;
+
+			if (turnCompleted) {
+				context.PositionHistory.pop_back();
 			}
 			// If we decreased the depth when calculating the next move score
 			// we add a depth penalty. Since this function is called recursively, we only
 			// adjust for 1 depth level at a time.
 			if (nextDepth < depth) {
-				nextBestScore = GetDepthAdjustedScore(nextBestScore, 1);
+				nextBestScore = GetDepthAdjustedScore(nextBestScore, static_cast<Depth>(1 + fastForwardedTurns));
 			}
 		}
 		return nextBestScore;
 	}
 
+	Score MinMaxStrategy::EvaluateLeaf(Game::PlayerId playerId, const Game::Game& game, SearchContext& context) const {
+		context.Statistics.AddLeafEvaluations(1);
+		const Score score = mOptions.Network ? EvaluateBoardNeural(playerId, game, *mOptions.Network) : EvaluateBoard(playerId, game);
+		if (mOptions.LeafPlayouts == 0) {
+			return score;
+		}
+
+		// Each playout scores +-c_WinConditionScore for a win or a loss and 0 for a draw
+		std::int64_t totalPlayoutScore = 0;
+		for (std::size_t i = 0; i < mOptions.LeafPlayouts; i++) {
+			Game::Game playoutGame = game;
+			const auto result = context.Playouts.Play(playoutGame, c_LeafPlayoutMaxTurns);
+			totalPlayoutScore += GameResultToScore(playerId, result);
+		}
+		const auto playoutScore = static_cast<Score>(totalPlayoutScore * c_LeafPlayoutScore / static_cast<std::int64_t>(mOptions.LeafPlayouts * c_WinConditionScore));
+		return score + static_cast<Score>(static_cast<float>(playoutScore - score) * mOptions.LeafPlayoutWeight);
+	}
+
+	SearchContext MinMaxStrategy::CreateSearchContext(const Game::Game& game, bool collectPrincipalVariations, SearchState& state) {
+		SearchContext context;
+		context.State = &state;
+		if (collectPrincipalVariations) {
+			// Every searched turn is made of two placement moves
+			context.PrincipalVariations = PrincipalVariationTable{ 2 * static_cast<std::size_t>(mDepth) };
+		}
+		context.Playouts = Game::PlayoutEngine{ mNextPlayoutSeed.fetch_add(1, std::memory_order_relaxed) };
+		// At most one position is recorded per searched turn, plus the starting position
+		context.PositionHistory.reserve(static_cast<std::size_t>(mDepth) + 1);
+		if (!game.GetState().FirstMoveExecuted) {
+			context.PositionHistory.push_back(game.GetHash());
+		}
+		return context;
+	}
+
 	Score MinMaxStrategy::GetLastExecutedMoveScore() const {
 		return mLastExecutedMoveScore;
 	}
+
+	bool MinMaxStrategy::GetLastExecutedMovePondered() const {
+		return mLastExecutedMovePondered;
+	}
+
+	const SearchStatistics& MinMaxStrategy::GetLastSearchStatistics() const {
+		return GetSearchStatistics(mLastSearchStatistics);
+	}
 }
@@ -0,0 +1,78 @@
+#include "minmax/MovePicker.hpp"
+
+#include "minmax/EvaluationTables.hpp"
+#include "minmax/config.hpp"
+
+#include <game/Board.hpp>
+
+#include <utility>
+
+namespace Alphalcazar::Strategy::MinMax {
+	// Blocked placements score 0, so the unblocked score is only an upper bound if it is never negative for the pieces that can be blocked
+	static_assert([] {
+		for (const auto& coordinates : Game::Coordinates::GetPerimeterCoordinates()) {
+			for (Game::PieceType pieceType = 1; pieceType <= Game::c_PieceTypes; pieceType++) {
+				for (std::size_t opponentBoardPieceCount = 0; opponentBoardPieceCount < c_OpponentPieceCounts; opponentBoardPieceCount++) {
+					if (pieceType != Game::c_PusherPieceType && c_PlacementMoveScoreTable[GetPlacementMoveScoreTableIndex(coordinates, pieceType, opponentBoardPieceCount)] < 0) {
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}(), "The placement scores of the pieces that can be blocked must not be negative");
+
+	MovePicker::MovePicker(Game::PlayerId playerId, const Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount>& legalMoves, const Game::Board& board)
+		: mBoard { board }
+	{
+		const auto [xSymmetry, ySymmetry] = GetBoardSymmetries(board);
+		const auto opponentId = playerId == Game::PlayerId::PLAYER_ONE ? Game::PlayerId::PLAYER_TWO : Game::PlayerId::PLAYER_ONE;
+		const std::size_t opponentBoardPieceCount = board.GetPieceCount(opponentId, true);
+		for (const auto& legalMove : legalMoves) {
+			if (!IsSymmetricalPlacement(legalMove.Coordinates, xSymmetry, ySymmetry)) {
+				ScoredPlacementMove move{ legalMove };
+				move.Score = GetUnblockedPlacementMoveScore(move, opponentBoardPieceCount);
+				mMoves.insert(move);
+			}
+		}
+	}
+
+	const ScoredPlacementMove* MovePicker::Next() {
+		if (mNextIndex == mMoves.size()) {
+			return nullptr;
+		}
+
+		while (true) {
+			std::size_t bestIndex = mNextIndex;
+			for (std::size_t i = mNextIndex + 1; i < mMoves.size(); i++) {
+				if (mMoves[i].Score > mMoves[bestIndex].Score) {
+					bestIndex = i;
+				}
+			}
+
+			if (!mExactScores[bestIndex]) {
+				mExactScores[bestIndex] = true;
+				if (IsPlacementBlocked(mMoves[bestIndex], mBoard)) {
+					// The move is worse than its upper bound suggested, so another move might be better now
+					mMoves[bestIndex].Score = 0;
+					continue;
+				}
+			}
+
+			// Move the selected move to the front of the remaining ones
+			std::swap(mMoves[mNextIndex], mMoves[bestIndex]);
+			const bool nextExactScore = mExactScores[mNextIndex];
+			mExactScores[mNextIndex] = mExactScores[bestIndex];
+			mExactScores[bestIndex] = nextExactScore;
+			return &mMoves[mNextIndex++];
+		}
+	}
+
+	std::size_t MovePicker::size() const {
+		return mMoves.size();
+	}
+
+	std::size_t MovePicker::GetHandedOutCount() const {
+		return mNextIndex;
+	}
+}
@@ -0,0 +1,174 @@
+#include "minmax/NeuralEvaluation.hpp"
+
+#include <game/Board.hpp>
+#include <game/Game.hpp>
+#include <game/Piece.hpp>
+#include <util/Log.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace Alphalcazar::Strategy::MinMax {
+	/// The magic number at the start of every network file ("ALNN" in little-endian byte order)
+	constexpr std::uint32_t c_NeuralFileMagic = 0x4E4E4C41;
+	/// The version of the network file format, increased whenever the layout of \ref NeuralNetwork changes
+	constexpr std::uint32_t c_NeuralFileVersion = 1;
+
+	/// Calls the specified function with each block of weights and biases of the network, in file order
+	template<typename Network, typename Function>
+	void ForEachNeuralNetworkBlock(Network& network, Function&& function) {
+		function(network.FirstLayerWeights);
+		function(network.FirstLayerBiases);
+		function(network.SecondLayerWeights);
+		function(network.SecondLayerBiases);
+		function(network.OutputWeights);
+		function(network.OutputBias);
+	}
+
+	std::unique_ptr<NeuralNetwork> NeuralNetwork::Load(const std::string& path) {
+		std::ifstream file{ path, std::ios::binary };
+		if (!file) {
+			Utils::LogError("Could not open neural network file {}", path);
+			return nullptr;
+		}
+
+		std::uint32_t magic = 0;
+		std::uint32_t version = 0;
+		file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+		file.read(reinterpret_cast<char*>(&version), sizeof(version));
+		if (!file) {
+			Utils::LogError("Neural network file {} is too short to hold a header", path);
+			return nullptr;
+		}
+		if (magic != c_NeuralFileMagic) {
+			Utils::LogError("File {} is not a neural network file", path);
+			return nullptr;
+		}
+		if (version != c_NeuralFileVersion) {
+			Utils::LogError("Neural network file {} has version {}, but version {} is expected", path, version, c_NeuralFileVersion);
+			return nullptr;
+		}
+
+		auto network = std::make_unique<NeuralNetwork>();
+		ForEachNeuralNetworkBlock(*network, [&file](auto& data) {
+			file.read(reinterpret_cast<char*>(&data), sizeof(data));
+		});
+		// The file must contain exactly the weights of the network, no more and no less
+		if (!file || file.peek() != std::ifstream::traits_type::eof()) {
+			Utils::LogError("Neural network file {} does not match the network size", path);
+			return nullptr;
+		}
+		return network;
+	}
+
+	bool NeuralNetwork::Save(const std::string& path) const {
+		std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+		file.write(reinterpret_cast<const char*>(&c_NeuralFileMagic), sizeof(c_NeuralFileMagic));
+		file.write(reinterpret_cast<const char*>(&c_NeuralFileVersion), sizeof(c_NeuralFileVersion));
+		ForEachNeuralNetworkBlock(*this, [&file](const auto& data) {
+			file.write(reinterpret_cast<const char*>(&data), sizeof(data));
+		});
+		file.flush();
+		if (!file) {
+			Utils::LogError("Could not write neural network file {}", path);
+			return false;
+		}
+		return true;
+	}
+
+	std::array<std::size_t, Game::c_PieceFeatureSlots> GetNeuralFeatures(const Game::Board& board) {
+		std::array<std::size_t, Game::c_PieceFeatureSlots> features;
+		for (std::size_t slot = 0; slot < Game::c_PieceFeatureSlots; slot++) {
+			features[slot] = Game::c_PieceHandFeatureOffset + slot;
+		}
+
+		auto [pieces, piecesCount] = board.GetPieces();
+		for (std::size_t i = 0; i < piecesCount; ++i) {
+			const auto& [coordinates, piece] = pieces[i];
+			features[Game::GetPieceFeatureSlot(piece.GetOwner(), piece.GetType())] = Game::GetPieceFeature(piece.GetOwner(), piece.GetType(), coordinates, piece.GetMovementDirection());
+		}
+		return features;
+	}
+
+	/// Adds first layer weights (of an input feature, or the biases) to the first layer values
+	void AddNeuralWeights(std::array<std::int16_t, c_NeuralFirstLayerSize>& values, const std::array<std::int16_t, c_NeuralFirstLayerSize>& weights) {
+#if defined(__AVX2__)
+		constexpr std::size_t c_Lanes = 16;
+		static_assert(c_NeuralFirstLayerSize % c_Lanes == 0);
+		for (std::size_t i = 0; i < c_NeuralFirstLayerSize; i += c_Lanes) {
+			auto* valuesVector = reinterpret_cast<__m256i*>(&values[i]);
+			const __m256i weightsVector = _mm256_load_si256(reinterpret_cast<const __m256i*>(&weights[i]));
+			_mm256_store_si256(valuesVector, _mm256_add_epi16(_mm256_load_si256(valuesVector), weightsVector));
+		}
+#else
+		for (std::size_t i = 0; i < c_NeuralFirstLayerSize; i++) {
+			values[i] = static_cast<std::int16_t>(values[i] + weights[i]);
+		}
+#endif
+	}
+
+	/// Returns the dot product of a layer input (activations from 0 to \ref c_NeuralActivationMax) and the weights of one of its neurons
+	std::int32_t NeuralDotProduct(const std::array<std::uint8_t, c_NeuralFirstLayerSize>& activations, const std::array<std::int8_t, c_NeuralFirstLayerSize>& weights) {
+#if defined(__AVX2__)
+		static_assert(c_NeuralFirstLayerSize == 32);
+		const __m256i activationsVector = _mm256_load_si256(reinterpret_cast<const __m256i*>(activations.data()));
+		const __m256i weightsVector = _mm256_load_si256(reinterpret_cast<const __m256i*>(weights.data()));
+		// Multiplies the unsigned activations with the signed weights and adds adjacent pairs into 16-bit values.
+		// Activations are at most 127, so the pairs can't saturate.
+		const __m256i pairSums = _mm256_maddubs_epi16(activationsVector, weightsVector);
+		const __m256i sums = _mm256_madd_epi16(pairSums, _mm256_set1_epi16(1));
+		// Horizontal sum of the 8 32-bit sums
+		const __m128i halfSums = _mm_add_epi32(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+		const __m128i quarterSums = _mm_add_epi32(halfSums, _mm_unpackhi_epi64(halfSums, halfSums));
+		const __m128i total = _mm_add_epi32(quarterSums, _mm_shuffle_epi32(quarterSums, 1));
+		return _mm_cvtsi128_si32(total);
+#else
+		std::int32_t total = 0;
+		for (std::size_t i = 0; i < c_NeuralFirstLayerSize; i++) {
+			total += static_cast<std::int32_t>(activations[i]) * weights[i];
+		}
+		return total;
+#endif
+	}
+
+	/// Applies the clipped ReLU activation to a neuron value
+	std::uint8_t GetNeuralActivation(std::int32_t value) {
+		return static_cast<std::uint8_t>(std::clamp(value, 0, c_NeuralActivationMax));
+	}
+
+	Score EvaluateBoardNeural(Game::PlayerId playerId, const Game::Game& game, const NeuralNetwork& network) {
+		static_assert(c_NeuralFirstLayerSize == c_NeuralSecondLayerSize, "The layers share the dot product implementation");
+		const Game::Board& board = game.GetBoard();
+		alignas(32) std::array<std::int16_t, c_NeuralFirstLayerSize> firstLayer;
+		if (board.GetPieceFeatureTable() == &network.FirstLayerWeights) {
+			// The board has kept the weights of the active features up to date as pieces moved, so we only add the biases
+			firstLayer = board.GetAccumulatedPieceFeatures();
+		} else {
+			firstLayer = {};
+			for (const std::size_t feature : GetNeuralFeatures(board)) {
+				AddNeuralWeights(firstLayer, network.FirstLayerWeights[feature]);
+			}
+		}
+		AddNeuralWeights(firstLayer, network.FirstLayerBiases);
+
+		alignas(32) std::array<std::uint8_t, c_NeuralFirstLayerSize> firstLayerActivations;
+		for (std::size_t i = 0; i < c_NeuralFirstLayerSize; i++) {
+			firstLayerActivations[i] = GetNeuralActivation(firstLayer[i]);
+		}
+
+		alignas(32) std::array<std::uint8_t, c_NeuralSecondLayerSize> secondLayerActivations;
+		for (std::size_t i = 0; i < c_NeuralSecondLayerSize; i++) {
+			const std::int32_t value = network.SecondLayerBiases[i] + NeuralDotProduct(firstLayerActivations, network.SecondLayerWeights[i]);
+			secondLayerActivations[i] = GetNeuralActivation(value >> c_NeuralSecondLayerShift);
+		}
+
+		const std::int32_t output = network.OutputBias + NeuralDotProduct(secondLayerActivations, network.OutputWeights);
+		// The network evaluates the board from player one's perspective
+		const Score playerOneScore = output >> c_NeuralOutputShift;
+		return playerId == Game::PlayerId::PLAYER_ONE ? playerOneScore : -playerOneScore;
+	}
+}
@@ -0,0 +1,49 @@
+#include "minmax/PrincipalVariation.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Alphalcazar::Strategy::MinMax {
+	PrincipalVariationTable::PrincipalVariationTable(std::size_t maxPly)
+		: mMoves(maxPly * (maxPly + 1) / 2)
+		, mLineLengths(maxPly + 1, 0)
+		, mMaxPly { maxPly }
+	{}
+
+	bool PrincipalVariationTable::IsEnabled() const {
+		return mMaxPly > 0;
+	}
+
+	void PrincipalVariationTable::Clear(std::size_t ply) {
+		if (ply <= mMaxPly) {
+			mLineLengths[ply] = 0;
+		}
+	}
+
+	void PrincipalVariationTable::Update(std::size_t ply, const Game::PlacementMove& move) {
+		if (ply >= mMaxPly) {
+			return;
+		}
+		const std::size_t offset = GetLineOffset(ply);
+		const std::size_t nextOffset = GetLineOffset(ply + 1);
+		const std::size_t nextLength = mLineLengths[ply + 1];
+		assert(nextLength < mMaxPly - ply);
+
+		mMoves[offset] = move;
+		std::copy_n(mMoves.begin() + static_cast<std::ptrdiff_t>(nextOffset), nextLength, mMoves.begin() + static_cast<std::ptrdiff_t>(offset + 1));
+		mLineLengths[ply] = nextLength + 1;
+	}
+
+	std::vector<Game::PlacementMove> PrincipalVariationTable::GetLine(std::size_t ply) const {
+		if (ply >= mMaxPly) {
+			return {};
+		}
+		const auto lineBegin = mMoves.begin() + static_cast<std::ptrdiff_t>(GetLineOffset(ply));
+		return { lineBegin, lineBegin + static_cast<std::ptrdiff_t>(mLineLengths[ply]) };
+	}
+
+	std::size_t PrincipalVariationTable::GetLineOffset(std::size_t ply) const {
+		// The line of ply i holds up to (mMaxPly - i) moves
+		return ply * mMaxPly - ply * (ply - 1) / 2;
+	}
+}
@@ -0,0 +1,42 @@
+#include "minmax/SearchStatistics.hpp"
+
+#include <cmath>
+#include <numeric>
+
+namespace Alphalcazar::Strategy::MinMax {
+	void SearchStatistics::Merge(const SearchStatistics& other) {
+		if (other.NodesPerPly.size() > NodesPerPly.size()) {
+			NodesPerPly.resize(other.NodesPerPly.size());
+		}
+		for (std::size_t i = 0; i < other.NodesPerPly.size(); i++) {
+			NodesPerPly[i] += other.NodesPerPly[i];
+		}
+		LeafEvaluations += other.LeafEvaluations;
+		Repetitions += other.Repetitions;
+		Cutoffs += other.Cutoffs;
+		for (std::size_t i = 0; i < c_CutoffMoveIndexBucketCount; i++) {
+			CutoffsByMoveIndex[i] += other.CutoffsByMoveIndex[i];
+		}
+		RootMoves.insert(RootMoves.end(), other.RootMoves.begin(), other.RootMoves.end());
+		Duration = std::max(Duration, other.Duration);
+	}
+
+	std::uint64_t SearchStatistics::GetNodes() const {
+		return std::accumulate(NodesPerPly.begin(), NodesPerPly.end(), std::uint64_t { 0 });
+	}
+
+	double SearchStatistics::GetEffectiveBranchingFactor() const {
+		if (NodesPerPly.size() < 2 || NodesPerPly.front() == 0) {
+			return 0.0;
+		}
+		const double growth = static_cast<double>(NodesPerPly.back()) / static_cast<double>(NodesPerPly.front());
+		return std::pow(growth, 1.0 / static_cast<double>(NodesPerPly.size() - 1));
+	}
+
+	double SearchStatistics::GetNodesPerSecond() const {
+		if (Duration.count() <= 0) {
+			return 0.0;
+		}
+		return static_cast<double>(GetNodes()) / std::chrono::duration<double>(Duration).count();
+	}
+}
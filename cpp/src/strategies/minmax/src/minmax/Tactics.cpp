@@ -0,0 +1,65 @@
+#include "minmax/Tactics.hpp"
+
+#include <game/Board.hpp>
+#include <game/Coordinates.hpp>
+#include <game/Game.hpp>
+#include <game/Piece.hpp>
+#include <game/board_utils.hpp>
+
+namespace Alphalcazar::Strategy::MinMax {
+	/// Executes the board moves that end the turn on a copy of the board and returns the resulting game result
+	Game::GameResult GetTurnEndResult(Game::Board board, Game::PlayerId playerWithInitiative) {
+		board.ExecuteMoves(playerWithInitiative);
+		return Game::GetRowMaskResult(board.GetBoardTileMask(Game::PlayerId::PLAYER_ONE), board.GetBoardTileMask(Game::PlayerId::PLAYER_TWO));
+	}
+
+	Utils::StaticVector<TacticalOutcome, Game::c_MaxLegalMovesCount> GetTacticalOutcomes(Game::PlayerId playerId, const Utils::StaticVector<ScoredPlacementMove, Game::c_MaxLegalMovesCount>& moves, const Game::Game& game) {
+		const auto opponentId = playerId == Game::PlayerId::PLAYER_ONE ? Game::PlayerId::PLAYER_TWO : Game::PlayerId::PLAYER_ONE;
+		const auto winResult = playerId == Game::PlayerId::PLAYER_ONE ? Game::GameResult::PLAYER_ONE_WINS : Game::GameResult::PLAYER_TWO_WINS;
+		const auto lossResult = playerId == Game::PlayerId::PLAYER_ONE ? Game::GameResult::PLAYER_TWO_WINS : Game::GameResult::PLAYER_ONE_WINS;
+		const auto playerWithInitiative = game.GetState().PlayerWithInitiative;
+		const bool opponentReplies = !game.GetState().FirstMoveExecuted;
+		constexpr auto perimeterCoordinates = Game::Coordinates::GetPerimeterCoordinates();
+
+		// The piece scores and features are not needed on the copies of the board
+		Game::Board board = game.GetBoard();
+		board.SetPieceScoreTable(nullptr);
+		board.SetPieceFeatureTable(nullptr);
+
+		Utils::StaticVector<TacticalOutcome, Game::c_MaxLegalMovesCount> result;
+		for (const auto& move : moves) {
+			Game::Board moveBoard = board;
+			moveBoard.PlacePiece(move.Coordinates, { playerId, move.PieceType });
+
+			const std::uint32_t tileMask = moveBoard.GetLegalPlacementMask();
+			const std::uint32_t pieceMask = static_cast<std::uint32_t>((~moveBoard.GetPiecePlacements(opponentId)).to_ulong());
+			if (!opponentReplies || tileMask == 0 || pieceMask == 0) {
+				// The turn ends right after the move
+				const auto turnEndResult = GetTurnEndResult(moveBoard, playerWithInitiative);
+				result.insert(turnEndResult == winResult ? TacticalOutcome::WIN : turnEndResult == lossResult ? TacticalOutcome::LOSS : TacticalOutcome::UNKNOWN);
+				continue;
+			}
+
+			// The move only wins if it wins against every reply, and loses if a single reply wins for the opponent
+			bool winsAgainstAllReplies = true;
+			bool losesAgainstAnyReply = false;
+			for (std::size_t tileIndex = 0; tileIndex < perimeterCoordinates.size() && !losesAgainstAnyReply; tileIndex++) {
+				if ((tileMask & (1U << tileIndex)) == 0) {
+					continue;
+				}
+				for (Game::PieceType pieceType = 1; pieceType <= Game::c_PieceTypes && !losesAgainstAnyReply; pieceType++) {
+					if ((pieceMask & (1U << (pieceType - 1))) == 0) {
+						continue;
+					}
+					Game::Board replyBoard = moveBoard;
+					replyBoard.PlacePiece(perimeterCoordinates[tileIndex], { opponentId, pieceType });
+					const auto turnEndResult = GetTurnEndResult(replyBoard, playerWithInitiative);
+					winsAgainstAllReplies &= turnEndResult == winResult;
+					losesAgainstAnyReply |= turnEndResult == lossResult;
+				}
+			}
+			result.insert(losesAgainstAnyReply ? TacticalOutcome::LOSS : winsAgainstAllReplies ? TacticalOutcome::WIN : TacticalOutcome::UNKNOWN);
+		}
+		return result;
+	}
+}
@@ -2,18 +2,22 @@
 
 #include "minmax/BoardEvaluation.hpp"
 #include "minmax/config.hpp"
+#include "minmax/EvaluationTables.hpp"
 
 #include <game/Game.hpp>
+#include <game/PlacementMove.hpp>
 
-#include "setuphelpers.hpp"
+#include <game/testhelpers.hpp>
+
+#include <vector>
 
 namespace Alphalcazar::Strategy::MinMax {
 	TEST(BoardEvaluation, EvaluateBoard) {
-		const std::vector<PieceSetup> pieceSetups {
+		const std::vector<Game::PieceSetup> pieceSetups {
 			{ Game::PlayerId::PLAYER_ONE, 1, Game::Direction::NORTH, { 2, 2 } },
 			{ Game::PlayerId::PLAYER_ONE, 5, Game::Direction::WEST, { 1, 1 } },
 		};
-		const Game::Game game = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
 
 		const Score score = EvaluateBoard(Game::PlayerId::PLAYER_ONE, game);
 		const Score opponentScore = EvaluateBoard(Game::PlayerId::PLAYER_TWO, game);
@@ -23,28 +27,28 @@ namespace Alphalcazar::Strategy::MinMax {
 	}
 
 	TEST(BoardEvaluation, EvaluatePieceLifeTime) {
-		const std::vector<PieceSetup> perimeterPieceSetups {
+		const std::vector<Game::PieceSetup> perimeterPieceSetups {
 			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::NORTH, { 1, 0 } },
 		};
-		const Game::Game perimeterGame = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, perimeterPieceSetups);
+		const Game::Game perimeterGame = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, perimeterPieceSetups);
 		const Score perimeterScore = EvaluateBoard(Game::PlayerId::PLAYER_ONE, perimeterGame);
 
-		const std::vector<PieceSetup> justEnteredPieceSetups{
+		const std::vector<Game::PieceSetup> justEnteredPieceSetups{
 			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::NORTH, { 1, 1 } },
 		};
-		const Game::Game justEnteredGame = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, justEnteredPieceSetups);
+		const Game::Game justEnteredGame = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, justEnteredPieceSetups);
 		const Score justEnteredScore = EvaluateBoard(Game::PlayerId::PLAYER_ONE, justEnteredGame);
 
-		const std::vector<PieceSetup> centerTilePieceSetups{
+		const std::vector<Game::PieceSetup> centerTilePieceSetups{
 			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::NORTH, { 1, 2 } },
 		};
-		const Game::Game centerTileGame = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, centerTilePieceSetups);
+		const Game::Game centerTileGame = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, centerTilePieceSetups);
 		const Score centerTileScore = EvaluateBoard(Game::PlayerId::PLAYER_ONE, centerTileGame);
 
-		const std::vector<PieceSetup> aboutToExitPieceSetups{
+		const std::vector<Game::PieceSetup> aboutToExitPieceSetups{
 			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::NORTH, { 1, 3 } },
 		};
-		const Game::Game aboutToExitGame = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, aboutToExitPieceSetups);
+		const Game::Game aboutToExitGame = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, aboutToExitPieceSetups);
 		const Score aboutToExitScore = EvaluateBoard(Game::PlayerId::PLAYER_ONE, aboutToExitGame);
 
 		// Pieces on the perimeter don't contribute to score
@@ -55,4 +59,68 @@ namespace Alphalcazar::Strategy::MinMax {
 		EXPECT_TRUE(justEnteredScore > centerTileScore);
 		EXPECT_TRUE(centerTileScore > aboutToExitScore);
 	}
+
+	TEST(BoardEvaluation, PieceScoreTable) {
+		struct ExpectedPieceScore {
+			Game::Coordinates Coordinates;
+			Game::Direction Direction;
+			Game::PieceType PieceType;
+			Score TableScore;
+		};
+		// The multiplier of every entry is worked out by hand from the position of the piece and the tile it moves to next
+		const std::vector<ExpectedPieceScore> expectedScores {
+			// In the center tile
+			{ { 2, 2 }, Game::Direction::NORTH, 1, static_cast<Score>(c_PieceOnBoardScores[0] * c_CenterPieceMultiplier) },
+			{ { 2, 2 }, Game::Direction::WEST, 4, static_cast<Score>(c_PieceOnBoardScores[3] * c_CenterPieceMultiplier) },
+			// In a corner, having just entered the board
+			{ { 1, 1 }, Game::Direction::NORTH, 2, static_cast<Score>(c_PieceOnBoardScores[1] * c_FreshCornerPieceMultiplier) },
+			{ { 3, 3 }, Game::Direction::WEST, 5, static_cast<Score>(c_PieceOnBoardScores[4] * c_FreshCornerPieceMultiplier) },
+			// In a corner, about to exit the board
+			{ { 1, 1 }, Game::Direction::WEST, 5, static_cast<Score>(c_PieceOnBoardScores[4] * c_PieceAboutToExitMultiplier) },
+			{ { 3, 1 }, Game::Direction::SOUTH, 3, static_cast<Score>(c_PieceOnBoardScores[2] * c_PieceAboutToExitMultiplier) },
+			// In a center lane, moving towards the center tile
+			{ { 1, 2 }, Game::Direction::EAST, 3, static_cast<Score>(c_PieceOnBoardScores[2] * c_FreshCenterLanePieceMultiplier) },
+			{ { 2, 3 }, Game::Direction::SOUTH, 4, static_cast<Score>(c_PieceOnBoardScores[3] * c_FreshCenterLanePieceMultiplier) },
+			// In a center lane, about to exit the board
+			{ { 1, 2 }, Game::Direction::WEST, 4, static_cast<Score>(c_PieceOnBoardScores[3] * c_PieceAboutToExitMultiplier) },
+			// In a center lane, moving towards a corner
+			{ { 2, 1 }, Game::Direction::EAST, 2, c_PieceOnBoardScores[1] },
+			{ { 3, 2 }, Game::Direction::SOUTH, 1, c_PieceOnBoardScores[0] },
+			// On the perimeter, outside of the board
+			{ { 1, 0 }, Game::Direction::NORTH, 2, 0 },
+			{ { 4, 2 }, Game::Direction::WEST, 3, 0 },
+		};
+		for (const auto& expectedScore : expectedScores) {
+			EXPECT_EQ(c_PieceScoreTable[Game::GetPieceScoreTableIndex(expectedScore.Coordinates, expectedScore.Direction, expectedScore.PieceType)], expectedScore.TableScore);
+		}
+
+		// Pieces on the perimeter don't contribute to score, whatever their direction
+		for (const auto& coordinates : Game::Coordinates::GetPerimeterCoordinates()) {
+			for (auto direction : { Game::Direction::NORTH, Game::Direction::SOUTH, Game::Direction::EAST, Game::Direction::WEST }) {
+				for (Game::PieceType pieceType = 1; pieceType <= Game::c_PieceTypes; pieceType++) {
+					EXPECT_EQ(c_PieceScoreTable[Game::GetPieceScoreTableIndex(coordinates, direction, pieceType)], 0);
+				}
+			}
+		}
+	}
+
+	TEST(BoardEvaluation, AccumulatedPieceScore) {
+		Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, false, {});
+		Game::Game accumulatingGame = game;
+		accumulatingGame.GetBoard().SetPieceScoreTable(&c_PieceScoreTable);
+
+		// Play both games in lockstep: the accumulated evaluation must always match the full one
+		Game::GameResult result = Game::GameResult::NONE;
+		std::size_t moveIndex = 0;
+		while (result == Game::GameResult::NONE && moveIndex < 40) {
+			const auto legalMoves = game.GetLegalMoves(game.GetActivePlayer());
+			const Game::PlacementMove move = legalMoves.empty() ? Game::PlacementMove{} : legalMoves[(moveIndex * 3) % legalMoves.size()];
+			result = game.PlayNextPlacementMove(move);
+			accumulatingGame.PlayNextPlacementMove(move);
+			for (auto playerId : { Game::PlayerId::PLAYER_ONE, Game::PlayerId::PLAYER_TWO }) {
+				EXPECT_EQ(EvaluateBoard(playerId, accumulatingGame), EvaluateBoard(playerId, game));
+			}
+			moveIndex++;
+		}
+	}
 }
@@ -2,6 +2,7 @@
 
 #include "minmax/LegalMovements.hpp"
 #include "minmax/config.hpp"
+#include "minmax/EvaluationTables.hpp"
 
 #include <game/Game.hpp>
 #include <game/Piece.hpp>
@@ -9,7 +10,9 @@
 #include <game/parameters.hpp>
 #include <game/PlacementMove.hpp>
 
-#include "setuphelpers.hpp"
+#include <game/testhelpers.hpp>
+
+#include <array>
 
 namespace Alphalcazar::Strategy::MinMax {
 	TEST(LegalMovements, CenterVerticalRowSymmetries) {
@@ -38,10 +41,10 @@ namespace Alphalcazar::Strategy::MinMax {
 	}
 
 	TEST(LegalMovements, CornerSymmetries) {
-		const std::vector<PieceSetup> pieceSetups{
+		const std::vector<Game::PieceSetup> pieceSetups{
 			{ Game::PlayerId::PLAYER_ONE, 1, Game::Direction::NORTH, { 1, 1 } },
 		};
-		Game::Game game = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
 
 		// A single piece on a corner breaks X and Y symmetries
 		auto [xSymmetry, ySymmetry] = GetBoardSymmetries(game.GetBoard());
@@ -50,10 +53,10 @@ namespace Alphalcazar::Strategy::MinMax {
 	}
 
 	TEST(LegalMovements, PerimeterSymmetries) {
-		std::vector<PieceSetup> pieceSetups{
+		std::vector<Game::PieceSetup> pieceSetups{
 			{ Game::PlayerId::PLAYER_ONE, 1, Game::Direction::WEST, { 4, 2 } },
 		};
-		Game::Game game = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
 
 		// The perimeter piece is on the x-axis and faces west, meaning we should still have
 		// x-axis symmetry
@@ -84,10 +87,10 @@ namespace Alphalcazar::Strategy::MinMax {
 	}
 
 	TEST(LegalMovements, FilterXAxisSymmetryMovements) {
-		std::vector<PieceSetup> pieceSetups{
+		std::vector<Game::PieceSetup> pieceSetups{
 			{ Game::PlayerId::PLAYER_ONE, 4, Game::Direction::SOUTH, { 2, 1 } },
 		};
-		Game::Game game = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
 
 		auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_TWO);
 		auto filteredMoves = SortAndFilterMovements(Game::PlayerId::PLAYER_ONE, legalMoves, game.GetBoard());
@@ -104,11 +107,11 @@ namespace Alphalcazar::Strategy::MinMax {
 	}
 
 	TEST(LegalMovements, FilterNoSymmetryMovements) {
-		std::vector<PieceSetup> pieceSetups{
+		std::vector<Game::PieceSetup> pieceSetups{
 			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::SOUTH, { 2, 3 } },
 			{ Game::PlayerId::PLAYER_ONE, 4, Game::Direction::EAST, { 2, 1 } },
 		};
-		Game::Game game = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
 
 		auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
 		auto filteredMoves = SortAndFilterMovements(Game::PlayerId::PLAYER_ONE, legalMoves, game.GetBoard());
@@ -121,11 +124,11 @@ namespace Alphalcazar::Strategy::MinMax {
 	}
 
 	TEST(LegalMovements, SortLegalMovements) {
-		std::vector<PieceSetup> pieceSetups{
+		std::vector<Game::PieceSetup> pieceSetups{
 			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::SOUTH, { 1, 1 } },
 			{ Game::PlayerId::PLAYER_TWO, 2, Game::Direction::EAST, { 2, 2 } },
 		};
-		Game::Game game = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
 
 		Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount> legalMoves;
 		// This movement will result in the piece not entering the board
@@ -145,4 +148,37 @@ namespace Alphalcazar::Strategy::MinMax {
 		EXPECT_EQ(sortedMoves[1].Coordinates.x, 3);
 		EXPECT_EQ(sortedMoves[2].Coordinates.x, 1);
 	}
+
+	TEST(LegalMovements, PlacementMoveScoreTable) {
+		for (const auto& coordinates : Game::Coordinates::GetPerimeterCoordinates()) {
+			for (Game::PieceType pieceType = 1; pieceType <= Game::c_PieceTypes; pieceType++) {
+				for (std::size_t opponentPieceCount = 0; opponentPieceCount <= Game::c_PieceTypes; opponentPieceCount++) {
+					// The precomputed scores must be identical to the ones computed with float arithmetic at runtime
+					Score expectedScore = c_PieceOnBoardScores[pieceType - 1];
+					if (pieceType == Game::c_PusherPieceType && opponentPieceCount >= 2) {
+						expectedScore += static_cast<Score>(c_PusherBonusPerOpponentPiece * opponentPieceCount);
+					}
+					volatile float laneMultiplier = coordinates.IsOnCenterLane() ? c_FreshCenterLanePieceMultiplier : c_FreshCornerPieceMultiplier;
+					expectedScore = static_cast<Score>(expectedScore >= 0 ? expectedScore * laneMultiplier : expectedScore / laneMultiplier);
+					expectedScore += c_PlacementPolicyScore * c_PlacementPolicyTable[GetPlacementPolicyTableIndex(coordinates, pieceType, opponentPieceCount)] / 255;
+
+					EXPECT_EQ(c_PlacementMoveScoreTable[GetPlacementMoveScoreTableIndex(coordinates, pieceType, opponentPieceCount)], expectedScore);
+				}
+			}
+		}
+	}
+
+	TEST(LegalMovements, PlacementPolicyTableIndex) {
+		std::array<bool, c_PlacementPolicyTableSize> usedIndices{};
+		for (const auto& coordinates : Game::Coordinates::GetPerimeterCoordinates()) {
+			for (Game::PieceType pieceType = 1; pieceType <= Game::c_PieceTypes; pieceType++) {
+				for (std::size_t opponentPieceCount = 0; opponentPieceCount <= Game::c_PieceTypes; opponentPieceCount++) {
+					const auto index = GetPlacementPolicyTableIndex(coordinates, pieceType, opponentPieceCount);
+					ASSERT_LT(index, c_PlacementPolicyTableSize);
+					EXPECT_FALSE(usedIndices[index]);
+					usedIndices[index] = true;
+				}
+			}
+		}
+	}
 }
@@ -1,15 +1,22 @@
 #include <gtest/gtest.h>
 
 #include "minmax/MinMaxStrategy.hpp"
+#include "minmax/SearchContext.hpp"
 #include "minmax/config.hpp"
 
 #include <game/Game.hpp>
 #include <game/parameters.hpp>
 #include <game/PlacementMove.hpp>
+#include <game/PlayoutEngine.hpp>
+#include <util/ThreadPool.hpp>
 
-#include "setuphelpers.hpp"
+#include <game/testhelpers.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <type_traits>
 
 namespace Alphalcazar::Strategy::MinMax {
 	TEST(MinMaxStrategy, TestWinningSecondMoveDepthOne) {
@@ -23,14 +30,14 @@ namespace Alphalcazar::Strategy::MinMax {
 		 * It's the only winning move as the (3,2) is about to be occupied by the opponent's 3,
 		 * and the 2 piece is the only non-pushable piece player 2 has that moves before that 3 piece.
 		 */
-		const std::vector<PieceSetup> pieceSetups {
+		const std::vector<Game::PieceSetup> pieceSetups {
 			{ Game::PlayerId::PLAYER_TWO, 3, Game::Direction::NORTH, { 1, 1 } },
 			{ Game::PlayerId::PLAYER_TWO, 4, Game::Direction::NORTH, { 2, 1 } },
 
 			{ Game::PlayerId::PLAYER_ONE, 3, Game::Direction::SOUTH, { 3, 3 } },
 			{ Game::PlayerId::PLAYER_ONE, 4, Game::Direction::EAST, { 0, 3 } }
 		};
-		Game::Game game = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
 
 		// Results should be the same independently of depth
 		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_TWO);
@@ -59,13 +66,13 @@ namespace Alphalcazar::Strategy::MinMax {
 		 * If the movement is not blocked, player 2 can win by playing anything on (2,4). The only way for player 2 to
 		 * avoid an immediate loss is to play any piece on (2,4).
 		 */
-		const std::vector<PieceSetup> pieceSetups {
+		const std::vector<Game::PieceSetup> pieceSetups {
 			{ Game::PlayerId::PLAYER_ONE, 5, Game::Direction::EAST, { 1, 1 } },
 			{ Game::PlayerId::PLAYER_ONE, 4, Game::Direction::WEST, { 3, 2 } },
 
 			{ Game::PlayerId::PLAYER_TWO, 4, Game::Direction::WEST, { 1, 2 } }
 		};
-		const Game::Game game = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_TWO, false, pieceSetups);
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_TWO, false, pieceSetups);
 
 		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_TWO);
 
@@ -103,7 +110,7 @@ namespace Alphalcazar::Strategy::MinMax {
 		 * enough as player 1 does not have the innitiative this turn. The only piece that can move before the opponent's
 		 * 2 and 3 is the 1 piece, which will be pushed and won't prevent the loss.
 		 */
-		const std::vector<PieceSetup> pieceSetups {
+		const std::vector<Game::PieceSetup> pieceSetups {
 			{ Game::PlayerId::PLAYER_TWO, 5, Game::Direction::SOUTH, { 2, 3 } },
 			{ Game::PlayerId::PLAYER_TWO, 2, Game::Direction::SOUTH, { 3, 3 } },
 			{ Game::PlayerId::PLAYER_TWO, 3, Game::Direction::NORTH, { 1, 1 } },
@@ -112,7 +119,7 @@ namespace Alphalcazar::Strategy::MinMax {
 
 			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::WEST, { 1, 3 } }
 		};
-		const Game::Game game = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_TWO, true, pieceSetups);
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_TWO, true, pieceSetups);
 
 		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
 
@@ -135,7 +142,7 @@ namespace Alphalcazar::Strategy::MinMax {
 		 * They can avoid losing this round by playing the pushing piece at (2,0), but next round they will
 		 * be unable to block both squares where P1 can mate, and will not have the pushing piece in hand.
 		 */
-		const std::vector<PieceSetup> pieceSetups {
+		const std::vector<Game::PieceSetup> pieceSetups {
 			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::SOUTH, { 2, 3 } },
 			{ Game::PlayerId::PLAYER_ONE, 3, Game::Direction::EAST, { 1, 2 } },
 			// The first move played this turn
@@ -144,7 +151,7 @@ namespace Alphalcazar::Strategy::MinMax {
 			{ Game::PlayerId::PLAYER_TWO, 1, Game::Direction::NORTH, { 2, 2 } },
 			{ Game::PlayerId::PLAYER_TWO, 2, Game::Direction::WEST, { 3, 2 } }
 		};
-		Game::Game game = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
 
 		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_TWO);
 
@@ -186,7 +193,7 @@ namespace Alphalcazar::Strategy::MinMax {
 		 * They only has piece 5 in hand, and as long as they keeps it for the next move (makes it not enter the board)
 		 * they will be able to use it next round to win the game, no reply from player 1 possible.
 		 */
-		const std::vector<PieceSetup> pieceSetups {
+		const std::vector<Game::PieceSetup> pieceSetups {
 			{ Game::PlayerId::PLAYER_ONE, 1, Game::Direction::EAST, { 2, 3 } },
 			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::WEST, { 3, 2 } },
 			// The first move played this turn
@@ -199,7 +206,7 @@ namespace Alphalcazar::Strategy::MinMax {
 			{ Game::PlayerId::PLAYER_TWO, 3, Game::Direction::WEST, { 3, 3 } },
 			{ Game::PlayerId::PLAYER_TWO, 4, Game::Direction::EAST, { 2, 2 } }
 		};
-		const Game::Game game = SetupGameForMinMaxTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
 
 		MinMaxStrategy strategy { 2 };
 		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_TWO);
@@ -217,4 +224,417 @@ namespace Alphalcazar::Strategy::MinMax {
 		EXPECT_EQ(std::find(tilesWhereFiveWouldEnter.begin(), tilesWhereFiveWouldEnter.end(), move.Coordinates), tilesWhereFiveWouldEnter.end());
 		EXPECT_EQ(strategy.GetLastExecutedMoveScore(), c_WinConditionScore - c_DepthScorePenalty);
 	}
+
+	TEST(MinMaxStrategy, OpponentWithoutPiecesInHand) {
+		/*
+		 * Player 2 has all of their pieces on the board, so they will have to skip their placement moves.
+		 * The search should treat those skipped placements as passes instead of as positions without
+		 * any available move, which would make any move of player 1 look better than a win.
+		 */
+		const std::vector<Game::PieceSetup> pieceSetups {
+			{ Game::PlayerId::PLAYER_TWO, 1, Game::Direction::NORTH, { 1, 1 } },
+			{ Game::PlayerId::PLAYER_TWO, 2, Game::Direction::SOUTH, { 1, 3 } },
+			{ Game::PlayerId::PLAYER_TWO, 3, Game::Direction::EAST, { 2, 1 } },
+			{ Game::PlayerId::PLAYER_TWO, 4, Game::Direction::WEST, { 3, 3 } },
+			{ Game::PlayerId::PLAYER_TWO, 5, Game::Direction::NORTH, { 3, 1 } },
+		};
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, false, pieceSetups);
+		EXPECT_FALSE(game.HasLegalMoves(Game::PlayerId::PLAYER_TWO));
+
+		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
+		for (Depth depth = 1; depth <= 2; depth++) {
+			MinMaxStrategy strategy{ depth, false };
+			const auto move = strategy.Execute(Game::PlayerId::PLAYER_ONE, legalMoves, game);
+
+			EXPECT_TRUE(move.Valid());
+			EXPECT_LE(std::abs(strategy.GetLastExecutedMoveScore()), c_WinConditionScore);
+		}
+	}
+
+	TEST(MinMaxStrategy, SearchContextRepetitions) {
+		SearchContext context;
+		EXPECT_FALSE(context.IsRepetition(1));
+
+		context.PositionHistory.push_back(1);
+		context.PositionHistory.push_back(2);
+		EXPECT_TRUE(context.IsRepetition(1));
+		EXPECT_TRUE(context.IsRepetition(2));
+		EXPECT_FALSE(context.IsRepetition(3));
+
+		// Once the search backtracks, the position is no longer part of the current line
+		context.PositionHistory.pop_back();
+		EXPECT_FALSE(context.IsRepetition(2));
+	}
+
+	TEST(MinMaxStrategy, RepetitionScoredAsDraw) {
+		/*
+		 * Both players only have their 1 piece left to place, and the pushers sit on the perimeter facing away
+		 * from the board, so they never move. Every move of player 1 loses, except placing the 1 piece on (4,1):
+		 * it moves to (3,1) and gets stuck there behind the 5 of player 2.
+		 *
+		 * Player 2 then has to place their 1 piece on (1,0) not to lose. It walks up the column and leaves the board
+		 * while the turns without placement moves are fast forwarded, which brings back the same position on every
+		 * turn player 2 places it again. The search sees that line looping and has to score it as a draw.
+		 */
+		const std::vector<Game::PieceSetup> pieceSetups {
+			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::WEST, { 0, 2 } },
+			{ Game::PlayerId::PLAYER_ONE, 3, Game::Direction::EAST, { 2, 2 } },
+			{ Game::PlayerId::PLAYER_ONE, 4, Game::Direction::SOUTH, { 3, 0 } },
+			{ Game::PlayerId::PLAYER_ONE, 5, Game::Direction::EAST, { 2, 3 } },
+
+			{ Game::PlayerId::PLAYER_TWO, 2, Game::Direction::WEST, { 3, 3 } },
+			{ Game::PlayerId::PLAYER_TWO, 3, Game::Direction::NORTH, { 3, 2 } },
+			{ Game::PlayerId::PLAYER_TWO, 4, Game::Direction::NORTH, { 3, 4 } },
+			{ Game::PlayerId::PLAYER_TWO, 5, Game::Direction::NORTH, { 2, 1 } }
+		};
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, false, pieceSetups);
+		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
+		const Game::PlacementMove drawingMove { { 4, 1 }, 1 };
+
+		MinMaxStrategy strategy{ 2, false };
+		EXPECT_EQ(strategy.Execute(Game::PlayerId::PLAYER_ONE, legalMoves, game), drawingMove);
+		EXPECT_EQ(strategy.GetLastExecutedMoveScore(), 0);
+
+		const auto analyzedMoves = strategy.Analyze(Game::PlayerId::PLAYER_ONE, legalMoves, game, legalMoves.size());
+		ASSERT_FALSE(analyzedMoves.empty());
+		EXPECT_EQ(analyzedMoves.front().Move, drawingMove);
+		EXPECT_EQ(analyzedMoves.front().Score, 0);
+		for (std::size_t i = 1; i < analyzedMoves.size(); ++i) {
+			EXPECT_EQ(analyzedMoves[i].Score, -c_WinConditionScore);
+		}
+
+		// The principal variation ends on the repeated position: the 1 of player 2 is placed on (1,0) twice
+		const Game::PlacementMove loopingMove { { 1, 0 }, 1 };
+		const auto& principalVariation = analyzedMoves.front().PrincipalVariation;
+		EXPECT_EQ(std::count(principalVariation.begin(), principalVariation.end(), loopingMove), 2);
+	}
+
+	TEST(MinMaxStrategy, SelfPlayGameEnds) {
+		// A full game between two min-max strategies should always reach a result
+		Game::Game game{};
+		MinMaxStrategy strategy{ 2 };
+		const auto result = game.Play(strategy, strategy);
+		EXPECT_NE(result, Game::GameResult::NONE);
+	}
+
+	TEST(MinMaxStrategy, SharedThreadPool) {
+		// Searches sharing a thread pool, or limited to fewer threads, find the same moves as a single-threaded search
+		Game::Game game{};
+		MinMaxStrategy referenceStrategy{ 2, false };
+		MinMaxOptions limitedOptions;
+		limitedOptions.MaxThreads = 2;
+		MinMaxStrategy limitedStrategy{ 2, true, limitedOptions };
+		Utils::ThreadPool threadPool { 2 };
+		MinMaxOptions injectedOptions;
+		injectedOptions.ThreadPool = &threadPool;
+		MinMaxStrategy injectedStrategy{ 2, true, injectedOptions };
+		Game::GameResult result = Game::GameResult::NONE;
+		for (std::size_t moveIndex = 0; moveIndex < 8 && result == Game::GameResult::NONE; moveIndex++) {
+			const Game::PlayerId playerId = game.GetActivePlayer();
+			const auto legalMoves = game.GetLegalMoves(playerId);
+			if (legalMoves.empty()) {
+				result = game.PlayNextPlacementMove({});
+				continue;
+			}
+			const auto referenceMove = referenceStrategy.Execute(playerId, legalMoves, game);
+			EXPECT_EQ(limitedStrategy.Execute(playerId, legalMoves, game), referenceMove);
+			EXPECT_EQ(limitedStrategy.GetLastExecutedMoveScore(), referenceStrategy.GetLastExecutedMoveScore());
+			EXPECT_EQ(injectedStrategy.Execute(playerId, legalMoves, game), referenceMove);
+			EXPECT_EQ(injectedStrategy.GetLastExecutedMoveScore(), referenceStrategy.GetLastExecutedMoveScore());
+			result = game.PlayNextPlacementMove(referenceMove);
+		}
+	}
+
+	TEST(MinMaxStrategy, SearchStatistics) {
+		// The searches only carry anything for the statistics if they are collected
+		static_assert(std::is_empty_v<CollectedSearchStatistics> != c_CollectSearchStatistics);
+		static_assert(std::is_empty_v<SearchStatisticsCollector<>> != c_CollectSearchStatistics);
+
+		const Game::Game game{};
+		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
+		for (bool multithreaded : { false, true }) {
+			MinMaxStrategy strategy{ 2, multithreaded };
+			strategy.Execute(Game::PlayerId::PLAYER_ONE, legalMoves, game);
+			const SearchStatistics& statistics = strategy.GetLastSearchStatistics();
+			if constexpr (!c_CollectSearchStatistics) {
+				EXPECT_EQ(statistics.GetNodes(), 0);
+				EXPECT_TRUE(statistics.RootMoves.empty());
+				continue;
+			}
+
+			// Every root move is searched completely, and the nodes of the search are the ones of its root moves
+			ASSERT_FALSE(statistics.NodesPerPly.empty());
+			EXPECT_EQ(statistics.NodesPerPly[0], statistics.RootMoves.size());
+			std::uint64_t rootMoveNodes = 0;
+			for (const auto& rootMove : statistics.RootMoves) {
+				rootMoveNodes += rootMove.Nodes;
+			}
+			EXPECT_EQ(rootMoveNodes, statistics.GetNodes());
+
+			// Two turns of two placement moves each
+			EXPECT_EQ(statistics.NodesPerPly.size(), 4);
+			EXPECT_GT(statistics.LeafEvaluations, 0);
+			EXPECT_GT(statistics.Cutoffs, 0);
+			std::uint64_t histogramCutoffs = 0;
+			for (const auto cutoffs : statistics.CutoffsByMoveIndex) {
+				histogramCutoffs += cutoffs;
+			}
+			EXPECT_EQ(histogramCutoffs, statistics.Cutoffs);
+			EXPECT_GT(statistics.GetEffectiveBranchingFactor(), 1.0);
+			EXPECT_GT(statistics.GetNodesPerSecond(), 0.0);
+		}
+	}
+
+	TEST(MinMaxStrategy, SharedThreadPoolDeadline) {
+		// A search sharing the thread pool with a longer one still returns shortly after its deadline
+		const Game::Game game{};
+		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
+		Utils::ThreadPool threadPool { 1 };
+		MinMaxOptions busyOptions;
+		busyOptions.ThreadPool = &threadPool;
+		// More tasks than threads, so that some of them stay queued ahead of the tasks of the other search
+		busyOptions.MaxThreads = 4;
+		MinMaxStrategy busyStrategy{ 20, true, busyOptions };
+		MinMaxOptions liveOptions;
+		liveOptions.ThreadPool = &threadPool;
+		MinMaxStrategy liveStrategy{ 20, true, liveOptions };
+
+		auto busyExecution = busyStrategy.ExecuteAsync(Game::PlayerId::PLAYER_ONE, legalMoves, game, Utils::StopToken::Clock::now() + std::chrono::seconds(20));
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		const auto start = Utils::StopToken::Clock::now();
+		const Utils::StopToken stopToken { start + std::chrono::milliseconds(50) };
+		const auto move = liveStrategy.ExecuteStoppable(Game::PlayerId::PLAYER_ONE, legalMoves, game, stopToken);
+		EXPECT_LT(Utils::StopToken::Clock::now() - start, std::chrono::seconds(2));
+		EXPECT_NE(std::find(legalMoves.begin(), legalMoves.end(), move), legalMoves.end());
+
+		busyExecution.Cancel();
+		busyExecution.Get();
+	}
+
+	TEST(MinMaxStrategy, LeafPlayouts) {
+		MinMaxOptions options;
+		options.LeafPlayouts = 8;
+
+		// The playouts only change the score of the leaves, so forced wins are still found
+		const std::vector<Game::PieceSetup> pieceSetups {
+			{ Game::PlayerId::PLAYER_TWO, 3, Game::Direction::NORTH, { 1, 1 } },
+			{ Game::PlayerId::PLAYER_TWO, 4, Game::Direction::NORTH, { 2, 1 } },
+
+			{ Game::PlayerId::PLAYER_ONE, 3, Game::Direction::SOUTH, { 3, 3 } },
+			{ Game::PlayerId::PLAYER_ONE, 4, Game::Direction::EAST, { 0, 3 } }
+		};
+		const Game::Game winningGame = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		const auto winningLegalMoves = winningGame.GetLegalMoves(Game::PlayerId::PLAYER_TWO);
+		for (bool multithreaded : { false, true }) {
+			MinMaxStrategy strategy{ 1, multithreaded, options };
+			const auto move = strategy.Execute(Game::PlayerId::PLAYER_TWO, winningLegalMoves, winningGame);
+			EXPECT_EQ(move.Coordinates, (Game::Coordinates{ 4, 2 }));
+			EXPECT_EQ(move.PieceType, 2);
+			EXPECT_EQ(strategy.GetLastExecutedMoveScore(), c_WinConditionScore);
+		}
+
+		// With the full weight on the playouts, the scores of the leaves are bounded by the playout score
+		options.LeafPlayoutWeight = 1.f;
+		const Game::Game game{};
+		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
+		MinMaxStrategy strategy{ 1, false, options };
+		const auto move = strategy.Execute(Game::PlayerId::PLAYER_ONE, legalMoves, game);
+		EXPECT_LE(std::abs(strategy.GetLastExecutedMoveScore()), c_LeafPlayoutScore);
+
+		// Single-threaded searches play the same playouts, so they are reproducible
+		MinMaxStrategy sameSeedStrategy{ 1, false, options };
+		EXPECT_EQ(sameSeedStrategy.Execute(Game::PlayerId::PLAYER_ONE, legalMoves, game), move);
+		EXPECT_EQ(sameSeedStrategy.GetLastExecutedMoveScore(), strategy.GetLastExecutedMoveScore());
+	}
+
+	TEST(MinMaxStrategy, Analyze) {
+		constexpr Depth depth = 2;
+		constexpr std::size_t moveCount = 3;
+		Game::PlayoutEngine engine{ 3 };
+		Game::Game game{};
+		Game::GameResult result = Game::GameResult::NONE;
+		for (std::size_t moveIndex = 0; moveIndex < 8 && result == Game::GameResult::NONE; moveIndex++) {
+			const Game::PlayerId playerId = game.GetActivePlayer();
+			const auto legalMoves = game.GetLegalMoves(playerId);
+			if (legalMoves.empty()) {
+				result = game.PlayNextPlacementMove({});
+				continue;
+			}
+
+			MinMaxStrategy strategy{ depth, false };
+			const auto analyzedMoves = strategy.Analyze(playerId, legalMoves, game, moveCount);
+			ASSERT_FALSE(analyzedMoves.empty());
+			EXPECT_LE(analyzedMoves.size(), moveCount);
+			for (std::size_t i = 0; i < analyzedMoves.size(); i++) {
+				const auto& analyzedMove = analyzedMoves[i];
+				if (i > 0) {
+					EXPECT_GE(analyzedMoves[i - 1].Score, analyzedMove.Score);
+				}
+
+				// The score of every move is the same as if it was the only move searched
+				Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount> singleMove;
+				singleMove.insert(analyzedMove.Move);
+				EXPECT_EQ(strategy.Analyze(playerId, singleMove, game, 1).front().Score, analyzedMove.Score);
+
+				// The principal variation starts with the move and can be played on the game
+				ASSERT_FALSE(analyzedMove.PrincipalVariation.empty());
+				EXPECT_LE(analyzedMove.PrincipalVariation.size(), 2 * static_cast<std::size_t>(depth));
+				EXPECT_EQ(analyzedMove.PrincipalVariation.front(), analyzedMove.Move);
+				Game::Game variationGame = game;
+				Game::GameResult variationResult = Game::GameResult::NONE;
+				for (const auto& variationMove : analyzedMove.PrincipalVariation) {
+					ASSERT_EQ(variationResult, Game::GameResult::NONE);
+					const auto variationLegalMoves = variationGame.GetLegalMoves(variationGame.GetActivePlayer());
+					if (variationMove.Valid()) {
+						EXPECT_NE(std::find(variationLegalMoves.begin(), variationLegalMoves.end(), variationMove), variationLegalMoves.end());
+					} else {
+						EXPECT_TRUE(variationLegalMoves.empty());
+					}
+					variationResult = variationGame.PlayNextPlacementMove(variationMove);
+				}
+			}
+
+			// Asking for fewer moves gives the same best score, and searching on multiple threads the same best moves,
+			// even though the threads search the moves in a different order and so rule out different moves by their bounds
+			EXPECT_EQ(strategy.Analyze(playerId, legalMoves, game, 1).front().Score, analyzedMoves.front().Score);
+			MinMaxStrategy multithreadedStrategy{ depth, true };
+			const auto multithreadedMoves = multithreadedStrategy.Analyze(playerId, legalMoves, game, moveCount);
+			ASSERT_EQ(multithreadedMoves.size(), analyzedMoves.size());
+			for (std::size_t i = 0; i < analyzedMoves.size(); i++) {
+				EXPECT_EQ(multithreadedMoves[i].Move, analyzedMoves[i].Move);
+				EXPECT_EQ(multithreadedMoves[i].Score, analyzedMoves[i].Score);
+			}
+
+			result = game.PlayNextPlacementMove(engine.SampleMove(game));
+		}
+	}
+
+	TEST(MinMaxStrategy, Ponder) {
+		for (PonderMode ponderMode : { PonderMode::PREDICTED_REPLY, PonderMode::ALL_REPLIES }) {
+			MinMaxOptions options;
+			options.Ponder = ponderMode;
+			MinMaxStrategy ponderingStrategy{ 2, false, options };
+			MinMaxStrategy referenceStrategy{ 2, false };
+
+			// The opponent plays random moves, so only some of them are predicted
+			Game::PlayoutEngine engine{ 11 };
+			Game::Game game{};
+			Game::GameResult result = Game::GameResult::NONE;
+			std::size_t ponderedMoves = 0;
+			while (result == Game::GameResult::NONE && game.GetState().Turn < 12) {
+				const Game::PlayerId playerId = game.GetActivePlayer();
+				const auto legalMoves = game.GetLegalMoves(playerId);
+				if (playerId == Game::PlayerId::PLAYER_TWO || legalMoves.empty()) {
+					result = Game::PlayoutEngine::PlayMove(game, engine.SampleMove(game));
+					continue;
+				}
+
+				// Answering from a background search gives the same move as searching from scratch
+				const auto move = ponderingStrategy.Execute(playerId, legalMoves, game);
+				EXPECT_EQ(move, referenceStrategy.Execute(playerId, legalMoves, game));
+				EXPECT_EQ(ponderingStrategy.GetLastExecutedMoveScore(), referenceStrategy.GetLastExecutedMoveScore());
+				ponderedMoves += ponderingStrategy.GetLastExecutedMovePondered() ? 1 : 0;
+				result = Game::PlayoutEngine::PlayMove(game, move);
+			}
+			// Player one plays its next move right after its own one every other turn, so those positions are always pondered
+			EXPECT_GT(ponderedMoves, 0u);
+		}
+	}
+
+	TEST(MinMaxStrategy, PonderRestrictedMoves) {
+		MinMaxOptions options;
+		options.Ponder = PonderMode::ALL_REPLIES;
+		MinMaxStrategy ponderingStrategy{ 2, false, options };
+
+		Game::PlayoutEngine engine{ 11 };
+		Game::Game game{};
+		Game::GameResult result = Game::GameResult::NONE;
+		while (result == Game::GameResult::NONE && game.GetState().Turn < 12) {
+			const Game::PlayerId playerId = game.GetActivePlayer();
+			const auto legalMoves = game.GetLegalMoves(playerId);
+			if (playerId == Game::PlayerId::PLAYER_TWO || legalMoves.empty()) {
+				result = Game::PlayoutEngine::PlayMove(game, engine.SampleMove(game));
+				continue;
+			}
+
+			// The positions are pondered with all their legal moves, so a search of them can't answer a caller that allows only one
+			Utils::StaticVector<Game::PlacementMove, Game::c_MaxLegalMovesCount> restrictedMoves;
+			restrictedMoves.insert(legalMoves[legalMoves.size() - 1]);
+			const auto move = ponderingStrategy.Execute(playerId, restrictedMoves, game);
+			EXPECT_EQ(move, restrictedMoves[0]);
+			EXPECT_FALSE(ponderingStrategy.GetLastExecutedMovePondered());
+			result = Game::PlayoutEngine::PlayMove(game, move);
+		}
+	}
+
+	TEST(MinMaxStrategy, PonderedSearchTakenOverOnBusyPool) {
+		// The only worker of the pool is kept busy by a normal task while the pondered positions are played, so the rest of
+		// the background search has to be run by the live search that takes it over
+		Utils::ThreadPool threadPool { 1 };
+		MinMaxOptions options;
+		options.Ponder = PonderMode::ALL_REPLIES;
+		options.ThreadPool = &threadPool;
+		MinMaxStrategy ponderingStrategy{ 2, true, options };
+		MinMaxStrategy referenceStrategy{ 2, false };
+
+		Game::PlayoutEngine engine{ 5 };
+		Game::Game game{};
+		Game::GameResult result = Game::GameResult::NONE;
+		std::size_t ponderedMoves = 0;
+		while (result == Game::GameResult::NONE && game.GetState().Turn < 8) {
+			const Game::PlayerId playerId = game.GetActivePlayer();
+			const auto legalMoves = game.GetLegalMoves(playerId);
+			if (playerId == Game::PlayerId::PLAYER_TWO || legalMoves.empty()) {
+				result = Game::PlayoutEngine::PlayMove(game, engine.SampleMove(game));
+				continue;
+			}
+
+			Utils::TaskLatch blockerLatch;
+			std::promise<void> started;
+			std::promise<void> unblock;
+			threadPool.Execute([&started, blocker = unblock.get_future().share()]() {
+				started.set_value();
+				// Bounded, so that a regression fails the test instead of hanging it
+				blocker.wait_for(std::chrono::seconds(30));
+			}, blockerLatch);
+			started.get_future().wait();
+
+			const auto start = std::chrono::steady_clock::now();
+			const auto move = ponderingStrategy.Execute(playerId, legalMoves, game);
+			EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+			EXPECT_EQ(move, referenceStrategy.Execute(playerId, legalMoves, game));
+			ponderedMoves += ponderingStrategy.GetLastExecutedMovePondered() ? 1 : 0;
+			unblock.set_value();
+			threadPool.Wait(blockerLatch);
+			result = Game::PlayoutEngine::PlayMove(game, move);
+		}
+		EXPECT_GT(ponderedMoves, 0u);
+	}
+
+	TEST(MinMaxStrategy, ExecuteStoppable) {
+		const Game::Game game{};
+		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
+		for (bool multithreaded : { false, true }) {
+			// A search stopped before it starts still returns one of the legal moves
+			MinMaxStrategy strategy{ 3, multithreaded };
+			const Utils::StopToken stoppedToken;
+			stoppedToken.RequestStop();
+			const auto move = strategy.ExecuteStoppable(Game::PlayerId::PLAYER_ONE, legalMoves, game, stoppedToken);
+			EXPECT_NE(std::find(legalMoves.begin(), legalMoves.end(), move), legalMoves.end());
+			EXPECT_EQ(strategy.GetLastExecutedMoveScore(), 0);
+
+			// A deep search returns shortly after its deadline
+			MinMaxStrategy deepStrategy{ 20, multithreaded };
+			const auto start = Utils::StopToken::Clock::now();
+			auto execution = deepStrategy.ExecuteAsync(Game::PlayerId::PLAYER_ONE, legalMoves, game, start + std::chrono::milliseconds(50));
+			const auto deadlineMove = execution.Get();
+			EXPECT_LT(Utils::StopToken::Clock::now() - start, std::chrono::seconds(5));
+			EXPECT_NE(std::find(legalMoves.begin(), legalMoves.end(), deadlineMove), legalMoves.end());
+
+			// Cancelling a search makes it return right away
+			auto cancelledExecution = deepStrategy.ExecuteAsync(Game::PlayerId::PLAYER_ONE, legalMoves, game);
+			cancelledExecution.Cancel();
+			EXPECT_NE(std::find(legalMoves.begin(), legalMoves.end(), cancelledExecution.Get()), legalMoves.end());
+		}
+	}
 }
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include "minmax/LegalMovements.hpp"
+#include "minmax/MovePicker.hpp"
+
+#include <game/Game.hpp>
+#include <game/PlacementMove.hpp>
+#include <game/PlayoutEngine.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace Alphalcazar::Strategy::MinMax {
+	TEST(MovePicker, MatchesSortAndFilterMovements) {
+		Game::PlayoutEngine engine{ 7 };
+		for (std::size_t gameIndex = 0; gameIndex < 50; gameIndex++) {
+			Game::Game game{};
+			Game::GameResult result = Game::GameResult::NONE;
+			while (result == Game::GameResult::NONE && game.GetState().Turn < 30) {
+				const auto playerId = game.GetActivePlayer();
+				const auto legalMoves = game.GetLegalMoves(playerId);
+				const auto sortedMoves = SortAndFilterMovements(playerId, legalMoves, game.GetBoard());
+
+				// The picker hands out the same moves, from the highest to the lowest score, with their exact scores
+				MovePicker movePicker{ playerId, legalMoves, game.GetBoard() };
+				EXPECT_EQ(movePicker.size(), sortedMoves.size());
+				std::vector<ScoredPlacementMove> pickedMoves;
+				while (const ScoredPlacementMove* move = movePicker.Next()) {
+					pickedMoves.push_back(*move);
+				}
+				ASSERT_EQ(pickedMoves.size(), sortedMoves.size());
+				for (std::size_t i = 0; i < pickedMoves.size(); i++) {
+					EXPECT_EQ(pickedMoves[i].Score, sortedMoves[i].Score);
+					EXPECT_NE(std::find(sortedMoves.begin(), sortedMoves.end(), pickedMoves[i]), sortedMoves.end());
+				}
+				EXPECT_EQ(movePicker.Next(), nullptr);
+
+				result = Game::PlayoutEngine::PlayMove(game, engine.SampleMove(game));
+			}
+		}
+	}
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include "minmax/MinMaxStrategy.hpp"
+#include "minmax/NeuralEvaluation.hpp"
+
+#include <game/Board.hpp>
+#include <game/Game.hpp>
+#include <game/PlacementMove.hpp>
+
+#include <game/testhelpers.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Alphalcazar::Strategy::MinMax {
+	/// Builds a network with arbitrary (but deterministic) weights
+	std::unique_ptr<NeuralNetwork> CreateTestNetwork() {
+		auto network = std::make_unique<NeuralNetwork>();
+		std::uint32_t state = 12345;
+		const auto next = [&state](std::int32_t min, std::int32_t max) {
+			state = state * 1664525u + 1013904223u;
+			return min + static_cast<std::int32_t>((state >> 8) % static_cast<std::uint32_t>(max - min + 1));
+		};
+		for (auto& row : network->FirstLayerWeights) {
+			for (auto& weight : row) {
+				weight = static_cast<std::int16_t>(next(-40, 40));
+			}
+		}
+		for (auto& bias : network->FirstLayerBiases) {
+			bias = static_cast<std::int16_t>(next(-20, 60));
+		}
+		for (auto& row : network->SecondLayerWeights) {
+			for (auto& weight : row) {
+				weight = static_cast<std::int8_t>(next(-128, 127));
+			}
+		}
+		for (auto& bias : network->SecondLayerBiases) {
+			bias = next(-500, 500);
+		}
+		for (auto& weight : network->OutputWeights) {
+			weight = static_cast<std::int8_t>(next(-128, 127));
+		}
+		network->OutputBias = next(-1000, 1000);
+		return network;
+	}
+
+	/// Returns the path of a file in the temporary directory
+	std::string GetTemporaryFilePath(const std::string& fileName) {
+		std::error_code error;
+		return (std::filesystem::temp_directory_path(error) / fileName).string();
+	}
+
+	/// Collects the positions of a game played with arbitrary (but deterministic) legal moves
+	std::vector<Game::Game> GetTestPositions(std::size_t count) {
+		Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, false, {});
+		std::vector<Game::Game> positions;
+		Game::GameResult result = Game::GameResult::NONE;
+		while (result == Game::GameResult::NONE && positions.size() < count) {
+			const auto legalMoves = game.GetLegalMoves(game.GetActivePlayer());
+			const Game::PlacementMove move = legalMoves.empty() ? Game::PlacementMove{} : legalMoves[(positions.size() * 11) % legalMoves.size()];
+			result = game.PlayNextPlacementMove(move);
+			positions.push_back(game);
+		}
+		return positions;
+	}
+
+	TEST(NeuralEvaluation, SaveAndLoad) {
+		const auto network = CreateTestNetwork();
+		const std::string path = GetTemporaryFilePath("alphalcazar_test_network.bin");
+		ASSERT_TRUE(network->Save(path));
+
+		const auto loadedNetwork = NeuralNetwork::Load(path);
+		ASSERT_NE(loadedNetwork, nullptr);
+		EXPECT_EQ(loadedNetwork->FirstLayerWeights, network->FirstLayerWeights);
+		EXPECT_EQ(loadedNetwork->FirstLayerBiases, network->FirstLayerBiases);
+		EXPECT_EQ(loadedNetwork->SecondLayerWeights, network->SecondLayerWeights);
+		EXPECT_EQ(loadedNetwork->SecondLayerBiases, network->SecondLayerBiases);
+		EXPECT_EQ(loadedNetwork->OutputWeights, network->OutputWeights);
+		EXPECT_EQ(loadedNetwork->OutputBias, network->OutputBias);
+
+		// A truncated file is rejected
+		std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+		EXPECT_EQ(NeuralNetwork::Load(path), nullptr);
+		std::remove(path.c_str());
+
+		// So is a file that doesn't exist or isn't a network file
+		EXPECT_EQ(NeuralNetwork::Load(GetTemporaryFilePath("alphalcazar_missing_network.bin")), nullptr);
+		const std::string invalidPath = GetTemporaryFilePath("alphalcazar_invalid_network.bin");
+		{
+			std::ofstream invalidFile{ invalidPath, std::ios::binary };
+			invalidFile << "not a network";
+		}
+		EXPECT_EQ(NeuralNetwork::Load(invalidPath), nullptr);
+
+		// Or a network file of another version, or one too short to hold a header at all
+		{
+			std::ofstream invalidFile{ invalidPath, std::ios::binary | std::ios::trunc };
+			const std::uint32_t header[] = { 0x4E4E4C41, 1000 };
+			invalidFile.write(reinterpret_cast<const char*>(header), sizeof(header));
+		}
+		EXPECT_EQ(NeuralNetwork::Load(invalidPath), nullptr);
+		std::filesystem::resize_file(invalidPath, 3);
+		EXPECT_EQ(NeuralNetwork::Load(invalidPath), nullptr);
+		std::remove(invalidPath.c_str());
+	}
+
+	TEST(NeuralEvaluation, EvaluateBoardNeural) {
+		const auto network = CreateTestNetwork();
+		for (const auto& position : GetTestPositions(30)) {
+			// Straightforward reference implementation of the network
+			std::array<std::int32_t, c_NeuralFirstLayerSize> firstLayer;
+			for (std::size_t i = 0; i < c_NeuralFirstLayerSize; i++) {
+				firstLayer[i] = network->FirstLayerBiases[i];
+				for (const std::size_t feature : GetNeuralFeatures(position.GetBoard())) {
+					firstLayer[i] += network->FirstLayerWeights[feature][i];
+				}
+				firstLayer[i] = std::clamp(firstLayer[i], 0, c_NeuralActivationMax);
+			}
+			std::int32_t output = network->OutputBias;
+			for (std::size_t i = 0; i < c_NeuralSecondLayerSize; i++) {
+				std::int32_t value = network->SecondLayerBiases[i];
+				for (std::size_t j = 0; j < c_NeuralFirstLayerSize; j++) {
+					value += firstLayer[j] * network->SecondLayerWeights[i][j];
+				}
+				output += std::clamp(value >> c_NeuralSecondLayerShift, 0, c_NeuralActivationMax) * network->OutputWeights[i];
+			}
+			const Score expectedScore = output >> c_NeuralOutputShift;
+
+			EXPECT_EQ(EvaluateBoardNeural(Game::PlayerId::PLAYER_ONE, position, *network), expectedScore);
+			EXPECT_EQ(EvaluateBoardNeural(Game::PlayerId::PLAYER_TWO, position, *network), -expectedScore);
+
+			// The first layer accumulated by the board gives the same scores
+			Game::Game accumulatingPosition = position;
+			accumulatingPosition.GetBoard().SetPieceFeatureTable(&network->FirstLayerWeights);
+			EXPECT_EQ(EvaluateBoardNeural(Game::PlayerId::PLAYER_ONE, accumulatingPosition, *network), expectedScore);
+			EXPECT_EQ(EvaluateBoardNeural(Game::PlayerId::PLAYER_TWO, accumulatingPosition, *network), -expectedScore);
+		}
+	}
+
+	TEST(NeuralEvaluation, MinMaxStrategyWithNetwork) {
+		MinMaxOptions options;
+		options.Network = CreateTestNetwork();
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, false, {});
+		const auto legalMoves = game.GetLegalMoves(Game::PlayerId::PLAYER_ONE);
+		for (bool multithreaded : { false, true }) {
+			MinMaxStrategy strategy{ 2, multithreaded, options };
+			const auto move = strategy.Execute(Game::PlayerId::PLAYER_ONE, legalMoves, game);
+			EXPECT_TRUE(move.Valid());
+		}
+	}
+}
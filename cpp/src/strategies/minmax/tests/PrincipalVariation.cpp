@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include "minmax/PrincipalVariation.hpp"
+
+#include <game/PlacementMove.hpp>
+
+#include <vector>
+
+namespace Alphalcazar::Strategy::MinMax {
+	TEST(PrincipalVariation, Table) {
+		const Game::PlacementMove firstMove { { 1, 0 }, 1 };
+		const Game::PlacementMove secondMove { { 0, 2 }, 4 };
+		const Game::PlacementMove thirdMove { { 3, 4 }, 2 };
+
+		PrincipalVariationTable table { 3 };
+		EXPECT_TRUE(table.IsEnabled());
+		table.Clear(3);
+		table.Update(2, thirdMove);
+		table.Update(1, secondMove);
+		table.Update(0, firstMove);
+		EXPECT_EQ(table.GetLine(0), (std::vector<Game::PlacementMove>{ firstMove, secondMove, thirdMove }));
+		EXPECT_EQ(table.GetLine(1), (std::vector<Game::PlacementMove>{ secondMove, thirdMove }));
+
+		// A node that finds a better move replaces its line, keeping the line of the next ply
+		table.Update(1, thirdMove);
+		table.Clear(2);
+		table.Update(1, firstMove);
+		table.Update(0, secondMove);
+		EXPECT_EQ(table.GetLine(0), (std::vector<Game::PlacementMove>{ secondMove, firstMove }));
+
+		// Plies past the end of the table are ignored
+		table.Update(3, firstMove);
+		EXPECT_TRUE(table.GetLine(3).empty());
+
+		// A disabled table ignores all updates
+		PrincipalVariationTable disabledTable;
+		EXPECT_FALSE(disabledTable.IsEnabled());
+		disabledTable.Update(0, firstMove);
+		EXPECT_TRUE(disabledTable.GetLine(0).empty());
+	}
+}
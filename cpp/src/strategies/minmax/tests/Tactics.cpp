@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "minmax/LegalMovements.hpp"
+#include "minmax/Tactics.hpp"
+
+#include <game/Game.hpp>
+#include <game/parameters.hpp>
+#include <game/PlacementMove.hpp>
+
+#include <game/testhelpers.hpp>
+
+namespace Alphalcazar::Strategy::MinMax {
+	TEST(Tactics, WinningSecondMove) {
+		// Same position as MinMaxStrategy.TestWinningSecondMoveDepthOne: only placing the 2 piece on (4,2) wins this turn
+		const std::vector<Game::PieceSetup> pieceSetups {
+			{ Game::PlayerId::PLAYER_TWO, 3, Game::Direction::NORTH, { 1, 1 } },
+			{ Game::PlayerId::PLAYER_TWO, 4, Game::Direction::NORTH, { 2, 1 } },
+
+			{ Game::PlayerId::PLAYER_ONE, 3, Game::Direction::SOUTH, { 3, 3 } },
+			{ Game::PlayerId::PLAYER_ONE, 4, Game::Direction::EAST, { 0, 3 } }
+		};
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_ONE, true, pieceSetups);
+		const auto moves = SortAndFilterMovements(Game::PlayerId::PLAYER_TWO, game.GetLegalMoves(Game::PlayerId::PLAYER_TWO), game.GetBoard());
+		const auto outcomes = GetTacticalOutcomes(Game::PlayerId::PLAYER_TWO, moves, game);
+
+		ASSERT_EQ(outcomes.size(), moves.size());
+		const Game::Coordinates winningCoordinates { 4, 2 };
+		for (std::size_t i = 0; i < moves.size(); i++) {
+			const bool winningMove = moves[i].Coordinates == winningCoordinates && moves[i].PieceType == 2;
+			EXPECT_EQ(outcomes[i] == TacticalOutcome::WIN, winningMove);
+		}
+	}
+
+	TEST(Tactics, LosingSecondMoves) {
+		// Same position as MinMaxStrategy.TestPlayerMustUserPusherPiece: only the pusher can avoid the loss
+		const std::vector<Game::PieceSetup> pieceSetups {
+			{ Game::PlayerId::PLAYER_TWO, 5, Game::Direction::SOUTH, { 2, 3 } },
+			{ Game::PlayerId::PLAYER_TWO, 2, Game::Direction::SOUTH, { 3, 3 } },
+			{ Game::PlayerId::PLAYER_TWO, 3, Game::Direction::NORTH, { 1, 1 } },
+			{ Game::PlayerId::PLAYER_TWO, 1, Game::Direction::WEST, { 4, 3 } },
+
+			{ Game::PlayerId::PLAYER_ONE, 2, Game::Direction::WEST, { 1, 3 } }
+		};
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_TWO, true, pieceSetups);
+		const auto moves = SortAndFilterMovements(Game::PlayerId::PLAYER_ONE, game.GetLegalMoves(Game::PlayerId::PLAYER_ONE), game.GetBoard());
+		const auto outcomes = GetTacticalOutcomes(Game::PlayerId::PLAYER_ONE, moves, game);
+
+		bool savingMoveFound = false;
+		for (std::size_t i = 0; i < moves.size(); i++) {
+			// Every outcome matches the result of actually playing the move
+			Game::Game gameCopy = game;
+			const auto result = gameCopy.PlayNextPlacementMove(moves[i]);
+			EXPECT_EQ(outcomes[i] == TacticalOutcome::LOSS, result == Game::GameResult::PLAYER_TWO_WINS);
+			EXPECT_NE(outcomes[i], TacticalOutcome::WIN);
+			if (moves[i].PieceType != Game::c_PusherPieceType) {
+				EXPECT_EQ(outcomes[i], TacticalOutcome::LOSS);
+			}
+			savingMoveFound |= outcomes[i] != TacticalOutcome::LOSS;
+		}
+		EXPECT_TRUE(savingMoveFound);
+	}
+
+	TEST(Tactics, LosingFirstMoves) {
+		// Same position as MinMaxStrategy.TestObviousFirstMovement: player 2 loses this turn unless they place a piece on (2,4)
+		const std::vector<Game::PieceSetup> pieceSetups {
+			{ Game::PlayerId::PLAYER_ONE, 5, Game::Direction::EAST, { 1, 1 } },
+			{ Game::PlayerId::PLAYER_ONE, 4, Game::Direction::WEST, { 3, 2 } },
+
+			{ Game::PlayerId::PLAYER_TWO, 4, Game::Direction::WEST, { 1, 2 } }
+		};
+		const Game::Game game = Game::SetupGameForTesting(Game::PlayerId::PLAYER_TWO, false, pieceSetups);
+		const auto moves = SortAndFilterMovements(Game::PlayerId::PLAYER_TWO, game.GetLegalMoves(Game::PlayerId::PLAYER_TWO), game.GetBoard());
+		const auto outcomes = GetTacticalOutcomes(Game::PlayerId::PLAYER_TWO, moves, game);
+
+		const Game::Coordinates blockingCoordinates { 2, 4 };
+		for (std::size_t i = 0; i < moves.size(); i++) {
+			EXPECT_NE(outcomes[i], TacticalOutcome::WIN);
+			if (moves[i].Coordinates != blockingCoordinates) {
+				EXPECT_EQ(outcomes[i], TacticalOutcome::LOSS);
+			}
+		}
+	}
+}
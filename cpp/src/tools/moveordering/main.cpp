@@ -0,0 +1,283 @@
+#include <game/Board.hpp>
+#include <game/Game.hpp>
+#include <game/PlacementMove.hpp>
+#include <game/PlayoutEngine.hpp>
+#include <minmax/BoardEvaluation.hpp>
+#include <minmax/EvaluationTables.hpp>
+#include <minmax/LegalMovements.hpp>
+#include <minmax/SearchStatistics.hpp>
+#include <minmax/config.hpp>
+
+#include <util/Log.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/*
+ * Measures how well the placement moves of the min-max search are ordered, on a suite of positions reached by random play.
+ *
+ * Usage: Alphalcazar.Tool.MoveOrdering [position count] [search depth]
+ *
+ * Every position is searched with a plain full-width alpha-beta search (without the tactics, pondering or batching of the
+ * min-max strategy) once per move ordering. For every ordering, the tool reports how often the first move of a node was its
+ * best move or caused its cutoff, the distribution of the indices of the moves that caused cutoffs per ply and per piece type,
+ * and the amount of nodes visited, which is what a better ordering ultimately saves.
+ */
+
+namespace {
+	/// The most random placement moves played to reach a position of the suite. Each position plays a different amount of them.
+	constexpr std::size_t c_MaxRandomOpeningMoves = 16;
+	/// The most games played to collect the positions of the suite, in case many of them end during their random moves
+	constexpr std::size_t c_MaxSuiteGamesPerPosition = 4;
+	/// The initial value of the alpha of the searches, lower than any score
+	constexpr Alphalcazar::Strategy::MinMax::Score c_AlphaStartingValue = -Alphalcazar::Strategy::MinMax::c_WinConditionScore * 10;
+	/// The initial value of the beta of the searches, higher than any score
+	constexpr Alphalcazar::Strategy::MinMax::Score c_BetaStartingValue = Alphalcazar::Strategy::MinMax::c_WinConditionScore * 10;
+
+	using LegalMoves = Alphalcazar::Utils::StaticVector<Alphalcazar::Game::PlacementMove, Alphalcazar::Game::c_MaxLegalMovesCount>;
+	using OrderedMoves = Alphalcazar::Utils::StaticVector<Alphalcazar::Strategy::MinMax::ScoredPlacementMove, Alphalcazar::Game::c_MaxLegalMovesCount>;
+	using CutoffHistogram = std::array<std::uint64_t, Alphalcazar::Strategy::MinMax::c_CutoffMoveIndexBucketCount>;
+
+	/// A way of ordering the moves of a search node. Every ordering searches the same moves, without the symmetrical ones.
+	struct MoveOrdering {
+		const char* Name;
+		OrderedMoves (*OrderMoves)(Alphalcazar::Game::PlayerId playerId, const LegalMoves& legalMoves, const Alphalcazar::Game::Board& board);
+	};
+
+	/// The statistics of the searches of all positions of the suite with one \ref MoveOrdering
+	struct OrderingStatistics {
+		/// The amount of placement moves played by the searches
+		std::uint64_t Nodes = 0;
+		/// The amount of nodes with several moves whose best move improved their alpha or beta, or caused a cutoff
+		std::uint64_t DecidedNodes = 0;
+		/// The amount of decided nodes in which that move was the first one searched
+		std::uint64_t FirstMoveDecidedNodes = 0;
+		/// Histograms of the index of the moves that caused cutoffs, per ply from the root of the search
+		std::vector<CutoffHistogram> CutoffsPerPly;
+		/// Histograms of the index of the moves that caused cutoffs, per piece type of those moves
+		std::array<CutoffHistogram, Alphalcazar::Game::c_PieceTypes> CutoffsPerPieceType {};
+	};
+
+	Alphalcazar::Game::PlayerId GetOpponent(Alphalcazar::Game::PlayerId playerId) {
+		return playerId == Alphalcazar::Game::PlayerId::PLAYER_ONE ? Alphalcazar::Game::PlayerId::PLAYER_TWO : Alphalcazar::Game::PlayerId::PLAYER_ONE;
+	}
+
+	/*!
+	 * \brief Returns the moves of \ref Alphalcazar::Strategy::MinMax::SortAndFilterMovements in the order of the legal moves,
+	 *        scored with the specified function, and sorted by that score (keeping the order of the legal moves between ties).
+	 */
+	template<Alphalcazar::Strategy::MinMax::Score (*ScoreMove)(const Alphalcazar::Game::PlacementMove&, const Alphalcazar::Game::Board&, std::size_t)>
+	OrderedMoves OrderByScore(Alphalcazar::Game::PlayerId playerId, const LegalMoves& legalMoves, const Alphalcazar::Game::Board& board) {
+		const auto filteredMoves = Alphalcazar::Strategy::MinMax::SortAndFilterMovements(playerId, legalMoves, board);
+		const std::size_t opponentBoardPieceCount = board.GetPieceCount(GetOpponent(playerId), true);
+		OrderedMoves moves;
+		for (const auto& legalMove : legalMoves) {
+			if (std::find(filteredMoves.begin(), filteredMoves.end(), legalMove) != filteredMoves.end()) {
+				Alphalcazar::Strategy::MinMax::ScoredPlacementMove move { legalMove };
+				move.Score = ScoreMove(move, board, opponentBoardPieceCount);
+				moves.insert(move);
+			}
+		}
+		std::stable_sort(moves.begin(), moves.end(), [](const Alphalcazar::Strategy::MinMax::ScoredPlacementMove& moveA, const Alphalcazar::Strategy::MinMax::ScoredPlacementMove& moveB) {
+			return moveA.Score > moveB.Score;
+		});
+		return moves;
+	}
+
+	/// The heuristic score without the bonus of the moves often played in self-play (see \ref Alphalcazar::Strategy::MinMax::c_PlacementPolicyTable)
+	Alphalcazar::Strategy::MinMax::Score GetScoreWithoutPolicy(const Alphalcazar::Game::PlacementMove& move, const Alphalcazar::Game::Board& board, std::size_t opponentBoardPieceCount) {
+		const auto score = Alphalcazar::Strategy::MinMax::GetHeuristicPlacementMoveScore(move, board, opponentBoardPieceCount);
+		if (score == 0) {
+			// Blocked placement
+			return score;
+		}
+		const auto policyIndex = Alphalcazar::Strategy::MinMax::GetPlacementPolicyTableIndex(move.Coordinates, move.PieceType, opponentBoardPieceCount);
+		return score - Alphalcazar::Strategy::MinMax::c_PlacementPolicyScore * Alphalcazar::Strategy::MinMax::c_PlacementPolicyTable[policyIndex] / 255;
+	}
+
+	/// The heuristic score without checking whether the piece can enter the board (see \ref Alphalcazar::Strategy::MinMax::IsPlacementBlocked)
+	Alphalcazar::Strategy::MinMax::Score GetUnblockedScore(const Alphalcazar::Game::PlacementMove& move, const Alphalcazar::Game::Board&, std::size_t opponentBoardPieceCount) {
+		return Alphalcazar::Strategy::MinMax::GetUnblockedPlacementMoveScore(move, opponentBoardPieceCount);
+	}
+
+	/// The same score for every move, which searches them in the order of the legal moves
+	Alphalcazar::Strategy::MinMax::Score GetNoScore(const Alphalcazar::Game::PlacementMove&, const Alphalcazar::Game::Board&, std::size_t) {
+		return 0;
+	}
+
+	/// The orderings to compare. The first one is the ordering of the min-max strategy, which the others are compared to.
+	constexpr std::array<MoveOrdering, 4> c_MoveOrderings {{
+		{ "heuristic", &Alphalcazar::Strategy::MinMax::SortAndFilterMovements },
+		{ "no policy", &OrderByScore<&GetScoreWithoutPolicy> },
+		{ "unblocked", &OrderByScore<&GetUnblockedScore> },
+		{ "legal order", &OrderByScore<&GetNoScore> },
+	}};
+
+	/*!
+	 * \brief A full-width alpha-beta search of a position that counts the statistics of its move ordering.
+	 *
+	 * Searches like \ref Alphalcazar::Strategy::MinMax::MinMaxStrategy, with the depth counted in complete turns, but without
+	 * any of the work it does outside of the alpha-beta search (tactics, repetitions, fast-forwarding...).
+	 */
+	class OrderingSearch {
+	public:
+		OrderingSearch(Alphalcazar::Game::PlayerId playerId, const MoveOrdering& ordering, OrderingStatistics& statistics)
+			: mPlayerId { playerId }
+			, mOrdering { ordering }
+			, mStatistics { statistics }
+		{}
+
+		/// Returns the score of the position for the player executing the search, searching the specified amount of turns
+		Alphalcazar::Strategy::MinMax::Score Search(const Alphalcazar::Game::Game& game, Alphalcazar::Strategy::MinMax::Depth depth, Alphalcazar::Strategy::MinMax::Score alpha, Alphalcazar::Strategy::MinMax::Score beta, std::size_t ply) {
+			if (depth == 0) {
+				return Alphalcazar::Strategy::MinMax::EvaluateBoard(mPlayerId, game);
+			}
+			const auto activePlayerId = game.GetActivePlayer();
+			const auto legalMoves = game.GetLegalMoves(activePlayerId);
+			if (legalMoves.empty()) {
+				return SearchMove(game, {}, depth, alpha, beta, ply);
+			}
+
+			const bool maximize = activePlayerId == mPlayerId;
+			const auto moves = mOrdering.OrderMoves(activePlayerId, legalMoves, game.GetBoard());
+			const auto startingBound = maximize ? alpha : beta;
+			auto bestScore = maximize ? c_AlphaStartingValue : c_BetaStartingValue;
+			std::size_t bestMoveIndex = 0;
+			for (std::size_t i = 0; i < moves.size(); i++) {
+				const auto score = SearchMove(game, moves[i], depth, alpha, beta, ply);
+				if (maximize ? score > bestScore : score < bestScore) {
+					bestScore = score;
+					bestMoveIndex = i;
+				}
+				if (maximize) {
+					alpha = std::max(alpha, bestScore);
+				} else {
+					beta = std::min(beta, bestScore);
+				}
+				// Same cutoff condition as the min-max strategy
+				if (alpha > beta) {
+					AddCutoff(ply, i, moves[i].PieceType);
+					AddDecidedNode(moves.size(), i);
+					return bestScore;
+				}
+			}
+			if (maximize ? bestScore > startingBound : bestScore < startingBound) {
+				AddDecidedNode(moves.size(), bestMoveIndex);
+			}
+			return bestScore;
+		}
+	private:
+		Alphalcazar::Strategy::MinMax::Score SearchMove(const Alphalcazar::Game::Game& game, const Alphalcazar::Game::PlacementMove& move, Alphalcazar::Strategy::MinMax::Depth depth, Alphalcazar::Strategy::MinMax::Score alpha, Alphalcazar::Strategy::MinMax::Score beta, std::size_t ply) {
+			mStatistics.Nodes++;
+			Alphalcazar::Game::Game gameCopy = game;
+			const auto result = gameCopy.PlayNextPlacementMove(move);
+			if (result != Alphalcazar::Game::GameResult::NONE) {
+				return Alphalcazar::Strategy::MinMax::GameResultToScore(mPlayerId, result);
+			}
+			// Only complete turns count towards the depth of the search
+			if (gameCopy.GetState().FirstMoveExecuted) {
+				return Search(gameCopy, depth, alpha, beta, ply + 1);
+			}
+			return Alphalcazar::Strategy::MinMax::GetDepthAdjustedScore(Search(gameCopy, depth - 1, alpha, beta, ply + 1), 1);
+		}
+
+		void AddCutoff(std::size_t ply, std::size_t moveIndex, Alphalcazar::Game::PieceType pieceType) {
+			if (ply >= mStatistics.CutoffsPerPly.size()) {
+				mStatistics.CutoffsPerPly.resize(ply + 1);
+			}
+			const std::size_t bucket = std::min(moveIndex, Alphalcazar::Strategy::MinMax::c_CutoffMoveIndexBucketCount - 1);
+			mStatistics.CutoffsPerPly[ply][bucket]++;
+			mStatistics.CutoffsPerPieceType[pieceType - 1][bucket]++;
+		}
+
+		void AddDecidedNode(std::size_t moveCount, std::size_t bestMoveIndex) {
+			// The ordering makes no difference with a single move
+			if (moveCount > 1) {
+				mStatistics.DecidedNodes++;
+				mStatistics.FirstMoveDecidedNodes += bestMoveIndex == 0;
+			}
+		}
+
+		Alphalcazar::Game::PlayerId mPlayerId;
+		const MoveOrdering& mOrdering;
+		OrderingStatistics& mStatistics;
+	};
+
+	/// Collects positions reached by random play in which the active player has placement moves to choose from
+	std::vector<Alphalcazar::Game::Game> CollectPositionSuite(std::size_t positionCount) {
+		std::vector<Alphalcazar::Game::Game> positions;
+		for (std::uint64_t seed = 0; positions.size() < positionCount && seed < positionCount * c_MaxSuiteGamesPerPosition; seed++) {
+			Alphalcazar::Game::Game game{};
+			game.GetBoard().SetPieceScoreTable(&Alphalcazar::Strategy::MinMax::c_PieceScoreTable);
+			Alphalcazar::Game::PlayoutEngine engine{ seed };
+			Alphalcazar::Game::GameResult result = Alphalcazar::Game::GameResult::NONE;
+			const std::size_t randomMoves = static_cast<std::size_t>(seed % (c_MaxRandomOpeningMoves + 1));
+			for (std::size_t i = 0; i < randomMoves && result == Alphalcazar::Game::GameResult::NONE; i++) {
+				result = Alphalcazar::Game::PlayoutEngine::PlayMove(game, engine.SampleMove(game));
+			}
+			if (result == Alphalcazar::Game::GameResult::NONE && game.GetLegalMoves(game.GetActivePlayer()).size() > 1) {
+				positions.push_back(game);
+			}
+		}
+		return positions;
+	}
+
+	double GetPercentage(std::uint64_t count, std::uint64_t total) {
+		return total > 0 ? 100. * static_cast<double>(count) / static_cast<double>(total) : 0.;
+	}
+
+	/// Formats a cutoff histogram as the percentage of the cutoffs caused by the move of each index
+	std::string FormatCutoffHistogram(const CutoffHistogram& histogram) {
+		std::uint64_t cutoffs = 0;
+		for (const auto count : histogram) {
+			cutoffs += count;
+		}
+		std::string result = fmt::format("{:>9} cutoffs:", cutoffs);
+		for (const auto count : histogram) {
+			result += fmt::format(" {:5.1f}%", GetPercentage(count, cutoffs));
+		}
+		return result;
+	}
+
+	void LogOrderingStatistics(const MoveOrdering& ordering, const OrderingStatistics& statistics) {
+		Alphalcazar::Utils::LogInfo("Cutoffs of the '{}' ordering by the index of the cutting move (the last column counts all later moves):", ordering.Name);
+		for (std::size_t ply = 0; ply < statistics.CutoffsPerPly.size(); ply++) {
+			Alphalcazar::Utils::LogInfo("  Ply {}:    {}", ply, FormatCutoffHistogram(statistics.CutoffsPerPly[ply]));
+		}
+		for (std::size_t i = 0; i < statistics.CutoffsPerPieceType.size(); i++) {
+			Alphalcazar::Utils::LogInfo("  Piece {}:  {}", i + 1, FormatCutoffHistogram(statistics.CutoffsPerPieceType[i]));
+		}
+	}
+}
+
+int main(int argc, char** argv) {
+	const std::size_t positionCount = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 50;
+	const auto depth = static_cast<Alphalcazar::Strategy::MinMax::Depth>(argc > 2 ? std::atoi(argv[2]) : 2);
+	if (positionCount == 0 || depth == 0) {
+		Alphalcazar::Utils::LogError("Usage: {} [position count] [search depth]", argv[0]);
+		return 1;
+	}
+
+	const auto positions = CollectPositionSuite(positionCount);
+	Alphalcazar::Utils::LogInfo("Searching {} positions at depth {} with {} move orderings", positions.size(), depth, c_MoveOrderings.size());
+	std::array<OrderingStatistics, c_MoveOrderings.size()> statistics{};
+	for (std::size_t i = 0; i < c_MoveOrderings.size(); i++) {
+		for (const auto& position : positions) {
+			OrderingSearch search { position.GetActivePlayer(), c_MoveOrderings[i], statistics[i] };
+			search.Search(position, depth, c_AlphaStartingValue, c_BetaStartingValue, 0);
+		}
+	}
+
+	Alphalcazar::Utils::LogInfo("{:>12} {:>12} {:>10} {:>12}", "Ordering", "Nodes", "vs first", "First best");
+	for (std::size_t i = 0; i < c_MoveOrderings.size(); i++) {
+		Alphalcazar::Utils::LogInfo("{:>12} {:>12} {:>9.1f}% {:>11.1f}%", c_MoveOrderings[i].Name, statistics[i].Nodes,
+			GetPercentage(statistics[i].Nodes, statistics[0].Nodes), GetPercentage(statistics[i].FirstMoveDecidedNodes, statistics[i].DecidedNodes));
+	}
+	for (std::size_t i = 0; i < c_MoveOrderings.size(); i++) {
+		LogOrderingStatistics(c_MoveOrderings[i], statistics[i]);
+	}
+	return 0;
+}
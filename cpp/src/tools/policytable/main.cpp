@@ -0,0 +1,144 @@
+#include <game/Board.hpp>
+#include <game/Game.hpp>
+#include <game/PlacementMove.hpp>
+#include <game/PlayoutEngine.hpp>
+#include <minmax/EvaluationTables.hpp>
+#include <minmax/LegalMovements.hpp>
+#include <minmax/MinMaxStrategy.hpp>
+#include <minmax/config.hpp>
+
+#include <util/Log.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+/*
+ * Generates the placement policy table of the min-max strategy (minmax/PolicyTable.hpp) from self-play games.
+ *
+ * Usage: Alphalcazar.Tool.PolicyTable <output header path> [game count] [search depth]
+ *
+ * For every move played by the min-max strategy, the tool counts how often each kind of placement move (perimeter tile,
+ * piece type and amount of opponent pieces on the board) was available and how often it was the chosen one. The table
+ * holds the rate at which each kind of move is chosen, scaled so that the most often chosen kind of move gets 255.
+ *
+ * The tool has to be built with the ENABLE_PLACEMENT_POLICY option turned off, so that the moves of the self-play games are
+ * ordered by the heuristic score alone and the current table has no say in the new one.
+ */
+
+namespace {
+	/// The amount of random placement moves played at the start of each game, so that the self-play games differ
+	constexpr std::size_t c_RandomOpeningMoves = 4;
+	/// The turn at which unfinished self-play games are abandoned
+	constexpr std::size_t c_MaxGameTurns = 100;
+	/*!
+	 * \brief The amount of times every kind of move counts as available without being chosen, on top of the actual counts.
+	 *
+	 * Keeps rarely available kinds of moves from getting extreme rates out of a handful of samples.
+	 */
+	constexpr double c_PriorAvailableCount = 20.;
+	/// The amount of table entries per line of the generated header
+	constexpr std::size_t c_EntriesPerLine = 24;
+	/// The amount of self-play games played if none is specified
+	constexpr std::size_t c_DefaultGameCount = 1000;
+
+	using PolicyCounts = std::array<std::uint64_t, Alphalcazar::Strategy::MinMax::c_PlacementPolicyTableSize>;
+
+	std::size_t GetPolicyIndex(Alphalcazar::Game::PlayerId playerId, const Alphalcazar::Game::PlacementMove& move, const Alphalcazar::Game::Board& board) {
+		const auto opponentId = playerId == Alphalcazar::Game::PlayerId::PLAYER_ONE ? Alphalcazar::Game::PlayerId::PLAYER_TWO : Alphalcazar::Game::PlayerId::PLAYER_ONE;
+		return Alphalcazar::Strategy::MinMax::GetPlacementPolicyTableIndex(move.Coordinates, move.PieceType, board.GetPieceCount(opponentId, true));
+	}
+
+	/// Plays a self-play game, counting the available and the chosen placement moves of every move of the min-max strategy
+	void PlaySelfPlayGame(std::uint64_t seed, Alphalcazar::Strategy::MinMax::MinMaxStrategy& strategy, PolicyCounts& availableCounts, PolicyCounts& chosenCounts) {
+		Alphalcazar::Game::Game game{};
+		Alphalcazar::Game::PlayoutEngine engine{ seed };
+		Alphalcazar::Game::GameResult result = Alphalcazar::Game::GameResult::NONE;
+		for (std::size_t i = 0; i < c_RandomOpeningMoves && result == Alphalcazar::Game::GameResult::NONE; i++) {
+			result = Alphalcazar::Game::PlayoutEngine::PlayMove(game, engine.SampleMove(game));
+		}
+
+		while (result == Alphalcazar::Game::GameResult::NONE && game.GetState().Turn < c_MaxGameTurns) {
+			const auto playerId = game.GetActivePlayer();
+			const auto legalMoves = game.GetLegalMoves(playerId);
+			if (legalMoves.empty()) {
+				result = Alphalcazar::Game::PlayoutEngine::PlayMove(game, {});
+				continue;
+			}
+
+			// Symmetrical moves are never chosen by the strategy, so they are not counted as available either
+			const auto& board = game.GetBoard();
+			for (const auto& candidateMove : Alphalcazar::Strategy::MinMax::SortAndFilterMovements(playerId, legalMoves, board)) {
+				availableCounts[GetPolicyIndex(playerId, candidateMove, board)]++;
+			}
+			const auto move = strategy.Execute(playerId, legalMoves, game);
+			chosenCounts[GetPolicyIndex(playerId, move, board)]++;
+
+			result = Alphalcazar::Game::PlayoutEngine::PlayMove(game, move);
+		}
+	}
+
+	/// Writes the policy table header. Returns false if the file could not be written.
+	bool WritePolicyTable(const std::string& path, const PolicyCounts& availableCounts, const PolicyCounts& chosenCounts, std::size_t gameCount, Alphalcazar::Strategy::MinMax::Depth depth) {
+		std::array<double, Alphalcazar::Strategy::MinMax::c_PlacementPolicyTableSize> rates{};
+		for (std::size_t i = 0; i < rates.size(); i++) {
+			rates[i] = static_cast<double>(chosenCounts[i]) / (static_cast<double>(availableCounts[i]) + c_PriorAvailableCount);
+		}
+		const double maxRate = std::max(*std::max_element(rates.begin(), rates.end()), 1e-9);
+
+		std::FILE* file = std::fopen(path.c_str(), "w");
+		if (!file) {
+			return false;
+		}
+		fmt::print(file, "#pragma once\n\n");
+		fmt::print(file, "// Generated by Alphalcazar.Tool.PolicyTable from {} self-play games at depth {}, with the placement policy turned off. Do not edit by hand.\n\n", gameCount, depth);
+		fmt::print(file, "#include <array>\n#include <cstdint>\n\n");
+		fmt::print(file, "namespace Alphalcazar::Strategy::MinMax {{\n");
+		fmt::print(file, "\t/*!\n");
+		fmt::print(file, "\t * \\brief How often each kind of placement move was played by the min-max strategy in self-play, when it was available.\n");
+		fmt::print(file, "\t *\n");
+		fmt::print(file, "\t * Scaled from 0 to 255 (the most often played kind of move). Indexed by \\ref GetPlacementPolicyTableIndex.\n");
+		fmt::print(file, "\t */\n");
+		fmt::print(file, "\tinline constexpr std::array<std::uint8_t, {}> c_PlacementPolicyTable = {{{{", rates.size());
+		for (std::size_t i = 0; i < rates.size(); i++) {
+			fmt::print(file, i % c_EntriesPerLine == 0 ? "\n\t\t" : " ");
+			const auto value = static_cast<unsigned>(rates[i] / maxRate * 255. + 0.5);
+			fmt::print(file, i + 1 < rates.size() ? "{}," : "{}", value);
+		}
+		fmt::print(file, "\n\t}}}};\n}}\n");
+		return std::fclose(file) == 0;
+	}
+}
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		Alphalcazar::Utils::LogError("Usage: {} <output header path> [game count] [search depth]", argv[0]);
+		return 1;
+	}
+	if constexpr (Alphalcazar::Strategy::MinMax::c_PlacementPolicyScore != 0) {
+		Alphalcazar::Utils::LogError("The policy table must be generated with the ENABLE_PLACEMENT_POLICY build option turned off");
+		return 1;
+	}
+	const std::string outputPath = argv[1];
+	const std::size_t gameCount = argc > 2 ? static_cast<std::size_t>(std::atoi(argv[2])) : c_DefaultGameCount;
+	const auto depth = static_cast<Alphalcazar::Strategy::MinMax::Depth>(argc > 3 ? std::atoi(argv[3]) : 2);
+
+	Alphalcazar::Strategy::MinMax::MinMaxStrategy strategy{ depth };
+	PolicyCounts availableCounts{};
+	PolicyCounts chosenCounts{};
+	for (std::size_t i = 0; i < gameCount; i++) {
+		PlaySelfPlayGame(i, strategy, availableCounts, chosenCounts);
+		if ((i + 1) % 50 == 0) {
+			Alphalcazar::Utils::LogInfo("Played {}/{} self-play games", i + 1, gameCount);
+		}
+	}
+
+	if (!WritePolicyTable(outputPath, availableCounts, chosenCounts, gameCount, depth)) {
+		Alphalcazar::Utils::LogError("Could not write the policy table to {}", outputPath);
+		return 1;
+	}
+	Alphalcazar::Utils::LogInfo("Wrote the policy table of {} self-play games to {}", gameCount, outputPath);
+	return 0;
+}
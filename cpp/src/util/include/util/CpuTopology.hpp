@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Alphalcazar::Utils {
+	/// A NUMA node of the machine: a group of cores that share the same local memory
+	struct NumaNode {
+		/// The indices of the logical cores of the node, as used to pin threads to them
+		std::vector<std::size_t> Cores;
+	};
+
+	/*!
+	 * \brief Returns the NUMA nodes of the machine.
+	 *
+	 * Only read from the OS on Linux. On other platforms, or if it can't be read, the machine is reported as a single
+	 * node holding as many cores as the hardware concurrency.
+	 */
+	std::vector<NumaNode> GetNumaNodes();
+
+	/*!
+	 * \brief Returns all cores of the machine, taking one core of each NUMA node in turn.
+	 *
+	 * Pinning threads to the first cores of this order spreads them evenly over the nodes, so that each node uses
+	 * its own memory bandwidth and caches.
+	 */
+	std::vector<std::size_t> GetNumaSpreadCores();
+}
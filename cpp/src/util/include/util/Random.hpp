@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace Alphalcazar::Utils {
+	/*!
+	 * \brief A small and fast seedable pseudo-random number generator (xoshiro256**).
+	 *
+	 * Much cheaper to create, copy and advance than std::mt19937, which makes it suitable for
+	 * running one generator per thread or per playout. It satisfies the UniformRandomBitGenerator
+	 * requirements, so it can also be used with the standard library distributions.
+	 *
+	 * \note Not suitable for cryptographic purposes.
+	 */
+	class Xoshiro256 {
+	public:
+		using result_type = std::uint64_t;
+
+		/// Creates a generator whose sequence is fully determined by the specified seed
+		explicit constexpr Xoshiro256(std::uint64_t seed = 0) {
+			Seed(seed);
+		}
+
+		/// Resets the generator to the start of the sequence of the specified seed
+		constexpr void Seed(std::uint64_t seed) {
+			// The state is expanded from the seed with splitmix64, as recommended by the xoshiro authors,
+			// which guarantees a non-zero state for any seed
+			for (auto& word : mState) {
+				seed += 0x9E3779B97F4A7C15ULL;
+				std::uint64_t value = seed;
+				value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+				word = value ^ (value >> 31);
+			}
+		}
+
+		static constexpr result_type min() {
+			return std::numeric_limits<result_type>::min();
+		}
+
+		static constexpr result_type max() {
+			return std::numeric_limits<result_type>::max();
+		}
+
+		/// Returns the next 64-bit value of the sequence
+		constexpr result_type operator()() {
+			const std::uint64_t result = RotateLeft(mState[1] * 5, 7) * 9;
+			const std::uint64_t t = mState[1] << 17;
+			mState[2] ^= mState[0];
+			mState[3] ^= mState[1];
+			mState[1] ^= mState[2];
+			mState[0] ^= mState[3];
+			mState[2] ^= t;
+			mState[3] = RotateLeft(mState[3], 45);
+			return result;
+		}
+
+		/*!
+		 * \brief Returns a value uniformly distributed in [0, bound), without divisions.
+		 *
+		 * Uses Lemire's multiply-shift method. The bias for the small bounds used in this project is negligible
+		 * (below 2^-26), so no rejection step is performed.
+		 */
+		constexpr std::uint32_t NextBounded(std::uint32_t bound) {
+			const std::uint64_t value = operator()() >> 32;
+			return static_cast<std::uint32_t>((value * bound) >> 32);
+		}
+	private:
+		static constexpr std::uint64_t RotateLeft(std::uint64_t value, int shift) {
+			return (value << shift) | (value >> (64 - shift));
+		}
+
+		std::uint64_t mState[4] = {};
+	};
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace Alphalcazar::Utils {
+	/*!
+	 * \brief A shared flag to ask some work running on other threads to stop, with an optional deadline.
+	 *
+	 * Copies of a token share the same flag, so the code that owns the work keeps a copy to request a stop,
+	 * and the work polls its own copy. Stopping is cooperative: nothing is interrupted, the work returns
+	 * early the next time it checks the token.
+	 */
+	class StopToken {
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		/// Creates a token that is stopped once a stop is requested, or once the deadline has passed
+		explicit StopToken(Clock::time_point deadline = Clock::time_point::max());
+
+		/// Asks the work using this token to stop
+		void RequestStop() const;
+
+		/*!
+		 * \brief Returns whether a stop has been requested.
+		 *
+		 * Does not look at the clock, so it is cheap enough to call on every node of a search.
+		 * Use \ref CheckDeadline regularly to turn a passed deadline (or a stop of the followed token) into a stop request.
+		 */
+		bool StopRequested() const {
+			return mState->Stopped.load(std::memory_order_relaxed);
+		}
+
+		/// Requests a stop if the deadline has passed, or if the followed token is stopped. Returns whether a stop has been requested.
+		bool CheckDeadline() const;
+
+		/*!
+		 * \brief Makes this token also stop once the other one does (ex. because of its deadline), as seen by \ref CheckDeadline.
+		 *
+		 * Meant for work started with its own token and later taken over by a caller with another one. A token can only
+		 * follow a single other token, and two tokens must not follow each other.
+		 */
+		void Follow(const StopToken& other) const;
+
+		/// Returns whether the token has a deadline
+		bool HasDeadline() const;
+
+		/// Returns the point in time at which the token stops by itself
+		Clock::time_point GetDeadline() const;
+
+		/// Returns whether both tokens are copies of the same token
+		bool operator==(const StopToken& other) const {
+			return mState == other.mState;
+		}
+	private:
+		struct State {
+			std::atomic<bool> Stopped = false;
+			Clock::time_point Deadline;
+			/// Keeps the followed token alive, only written before \ref FollowedState is set
+			std::shared_ptr<State> Followed;
+			/// The state of the followed token, if any
+			std::atomic<State*> FollowedState = nullptr;
+		};
+
+		/// Implementation of \ref CheckDeadline, recursing into the followed tokens
+		static bool CheckDeadline(State& state);
+
+		/// The state shared by all copies of the token
+		std::shared_ptr<State> mState;
+	};
+}
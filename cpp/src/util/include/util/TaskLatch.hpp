@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace Alphalcazar::Utils {
+	/*!
+	 * \brief A counter of unfinished tasks that threads can wait on until it reaches zero.
+	 *
+	 * A lightweight alternative to a std::future per task when only the completion of a group of tasks matters:
+	 * results are written by the tasks to memory owned by the waiter. Counting down only locks the mutex for
+	 * the last task, the others just decrement the counter.
+	 *
+	 * A latch can be reused once it is done, by adding more tasks to it.
+	 */
+	class TaskLatch {
+	public:
+		explicit TaskLatch(std::size_t count = 0);
+
+		TaskLatch(const TaskLatch&) = delete;
+		TaskLatch& operator=(const TaskLatch&) = delete;
+
+		/// Adds tasks to wait for
+		void Add(std::size_t count = 1);
+
+		/// Marks one task as finished, and wakes up the waiting threads if it was the last one
+		void CountDown();
+
+		/// Returns whether all tasks are finished. Once it does, the latch can be destroyed.
+		bool IsDone() const;
+
+		/// Waits until all tasks are finished
+		void Wait() const;
+
+		/// Waits until all tasks are finished, or until the timeout passes. Returns whether all tasks are finished.
+		template<typename Rep, typename Period>
+		bool WaitFor(const std::chrono::duration<Rep, Period>& timeout) const {
+			std::unique_lock lock { mMutex };
+			return mDoneConditionVariable.wait_for(lock, timeout, [this]() { return mCount.load(std::memory_order_acquire) == 0; });
+		}
+	private:
+		/// The amount of unfinished tasks
+		std::atomic<std::size_t> mCount;
+		/// Guards the last count down, so that waiters can't miss it (nor destroy the latch while it is notifying them)
+		mutable std::mutex mMutex;
+		/// Notified once the count reaches zero
+		mutable std::condition_variable mDoneConditionVariable;
+	};
+}
@@ -1,91 +1,431 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <thread>
 #include <future>
-#include <queue>
-#include <functional>
+#include <memory>
+#include <new>
 #include <mutex>
 #include <condition_variable>
 #include <type_traits>
 
+#include "util/CpuTopology.hpp"
+#include "util/StopToken.hpp"
+#include "util/TaskLatch.hpp"
+#include "util/ThreadPoolStatistics.hpp"
+#include "util/WorkStealingDeque.hpp"
+
 namespace Alphalcazar::Utils {
+    class Xoshiro256;
+
+    /// How the worker threads of a \ref ThreadPool are started
+    struct ThreadPoolOptions {
+        /// The amount of worker threads
+        std::size_t ThreadCount = std::thread::hardware_concurrency();
+
+        /*!
+         * \brief Whether every worker thread is pinned to a single core, so that the OS doesn't migrate it.
+         *
+         * Memory is usually placed on the NUMA node of the thread that first writes to it, so the state a pinned worker
+         * creates while running a task (such as a search context, or the slab of the tasks it queues) stays local to its node.
+         */
+        bool PinThreads = false;
+
+        /*!
+         * \brief The cores the worker threads are pinned to if \ref PinThreads is set: the i-th worker is pinned to the
+         *        (i % size)-th core. If empty, the workers are spread over the NUMA nodes (see \ref GetNumaSpreadCores).
+         */
+        std::vector<std::size_t> Cores;
+
+        /// The stack size of the worker threads in bytes, or 0 to use the default one of the platform
+        std::size_t StackSize = 0;
+    };
+
+    /// The lanes of a \ref ThreadPool. Workers always pick up the queued tasks of a lane before the ones of the lanes after it.
+    enum class TaskPriority : std::uint8_t {
+        /// Latency-critical work, such as the move search of a live game. The default priority.
+        NORMAL,
+        /// Work that can wait, such as pondering or batch analysis. Only picked up when no normal task is queued.
+        BACKGROUND
+    };
+
+    /// The amount of values of \ref TaskPriority
+    constexpr std::size_t c_TaskPriorityCount = 2;
+
     /*!
-     * \brief Basic implementation of a thread pool.
+     * \brief Sets the priority of the tasks queued by the current thread, as long as the scope is alive.
+     *
+     * Tasks run with the priority they were queued with, and the tasks they queue inherit it. So wrapping the code that
+     * starts some work (ex. a call to \ref Game::Strategy::Execute for a batch analysis) moves all of its tasks to a lane.
+     */
+    class TaskPriorityScope {
+    public:
+        explicit TaskPriorityScope(TaskPriority priority);
+        ~TaskPriorityScope();
+
+        TaskPriorityScope(const TaskPriorityScope&) = delete;
+        TaskPriorityScope& operator=(const TaskPriorityScope&) = delete;
+
+        /// Returns the priority of the tasks queued by the current thread
+        static TaskPriority GetCurrent();
+    private:
+        /// The priority of the current thread before the scope, restored once it ends
+        TaskPriority mPreviousPriority;
+    };
+
+    /*!
+     * \brief A work-stealing thread pool.
      * 
      * Runs a fixed amount of worker threads.
-     * Queue tasks with Execute() wait on the returned std::future to use it.
-     * Tasks are guaranteed be picked up by the worker threads in the order they are queued.
+     * Queue tasks with Execute() wait on the returned std::future to use it, or count them on a \ref TaskLatch.
+     *
+     * Every worker thread owns a lock-free \ref WorkStealingDeque. Tasks queued from a worker thread (by another task)
+     * go to the deque of that worker, which runs them last-in first-out, and idle workers steal tasks from the deques of
+     * random other workers. Tasks queued from any other thread go through a shared injection queue, and are picked up in
+     * the order they are queued. Idle workers only go to sleep once there are no tasks left anywhere.
+     *
+     * The injection queue is split in lanes, one per \ref TaskPriority: background tasks are only picked up once no normal
+     * task is queued. Background tasks always go through the injection queue, even when queued from a worker thread, so
+     * that the threads waiting on them can always find them (see \ref Wait). Running tasks are never interrupted, so long
+     * background tasks should check \ref ShouldYield at the boundaries of their work.
+     *
+     * Tasks are stored in fixed-size slots, taken from a slab owned by the thread queuing them and given back to it
+     * once they have run, so queuing a task doesn't allocate unless it captures more than \ref c_TaskStorageSize bytes.
+     * Together with a \ref TaskLatch, spawning and joining tasks doesn't touch the global allocator at all.
+     *
+     * Threads waiting on a latch through \ref Wait run the queued tasks of that latch until it is done, instead of blocking.
+     * This keeps the waiting thread busy, and makes waiting from inside a task safe: a worker thread waiting on tasks it
+     * queued runs them itself if no other worker picked them up, so nested parallelism can't deadlock the pool. Queued
+     * tasks of unrelated work are left to the workers, so that they can't hold up a waiting thread, while the tasks of the
+     * latch are run whatever their priority, so that work taken over by a thread of a higher priority can't be starved.
+     *
+     * Most users share the process-wide pool returned by \ref GetShared instead of starting their own threads, so that
+     * any amount of them can run in the same process without oversubscribing the cores.
      */
     class ThreadPool {
     public:
+        /// The size of the captures a task can have without being allocated separately
+        static constexpr std::size_t c_TaskStorageSize = 64;
+
         ThreadPool(size_t threadCount = std::thread::hardware_concurrency());
+        explicit ThreadPool(const ThreadPoolOptions& options);
         ~ThreadPool();
 
         ThreadPool(const ThreadPool&) = delete;
         ThreadPool& operator=(const ThreadPool&) = delete;
 
+        /*!
+         * \brief Returns the thread pool shared by the whole process, started on the first call.
+         *
+         * It has one worker thread less than the hardware concurrency (but at least one), as the threads queuing tasks
+         * usually help running them while they wait (see \ref Wait).
+         */
+        static ThreadPool& GetShared();
+
+        /*!
+         * \brief Sets the options the shared thread pool is started with (see \ref GetShared).
+         *
+         * By default, its workers have a stack of \ref c_SharedThreadPoolStackSize bytes and are not pinned.
+         *
+         * \returns Whether the options are used, which is only the case if the shared thread pool has not been started yet.
+         */
+        static bool ConfigureShared(const ThreadPoolOptions& options);
+
+        /// The stack size of the workers of the shared thread pool unless configured otherwise, so that deep searches have the same headroom on all platforms
+        static constexpr std::size_t c_SharedThreadPoolStackSize = 8 * 1024 * 1024;
+
         template <typename F>
         /// Runs a task on the thread pool and returns a future for that task's result
         auto Execute(F function);
+
+        template <typename F>
+        /*!
+         * \brief Runs a task on the thread pool, unless a stop is requested on the token before a worker thread picks it up.
+         *
+         * Dropped tasks don't run at all, and their future holds a default constructed result. Meant for the tasks of work
+         * that can be cancelled as a whole, so that its queued tasks don't keep the worker threads busy once it is.
+         */
+        auto Execute(F function, const StopToken& stopToken);
+
+        template <typename F>
+        /*!
+         * \brief Runs a task on the thread pool and counts it down on the latch once it has run.
+         *
+         * The task is added to the latch before being queued. Its result is discarded, so tasks that produce something
+         * write it to memory owned by the thread waiting on the latch.
+         */
+        void Execute(F function, TaskLatch& latch);
+
+        template <typename F>
+        /// Same as Execute(F, TaskLatch&), but the task is dropped (and counted down right away) if a stop is requested on the token before it runs
+        void Execute(F function, TaskLatch& latch, const StopToken& stopToken);
+
+        /*!
+         * \brief Runs the function on every index of the range [begin, end), split in chunks run in parallel, and waits for all of them.
+         *
+         * The calling thread takes part in running the chunks (see \ref Wait), so it can also be called from a task.
+         *
+         * \param grainSize The minimum amount of indices per chunk, to make up for the cost of queuing chunks of cheap iterations.
+         */
+        template <typename F>
+        void ParallelFor(std::size_t begin, std::size_t end, F function, std::size_t grainSize = 1);
+
+        /*!
+         * \brief Runs the queued tasks of the latch on the calling thread until the latch is done.
+         *
+         * Helps with the tasks counted by the latch that were queued by threads that are not workers or that are background
+         * tasks, and with the tasks the calling thread queued itself if it is a worker. Normal tasks queued by other workers
+         * are left to them, so that the calling thread can't be held up by the tasks of unrelated work sharing the pool.
+         * The background tasks of the latch are run even by a thread of a higher priority, as it is waiting for them anyway.
+         */
+        void Wait(const TaskLatch& latch);
+
+        /*!
+         * \brief Runs the queued tasks of the latch on the calling thread (see \ref Wait) until the latch is done, or until the timeout passes.
+         *        Returns whether the latch is done.
+         *
+         * A task that is started before the timeout passes is run to completion, so the call can return later than the timeout.
+         */
+        template<typename Rep, typename Period>
+        bool WaitFor(const TaskLatch& latch, const std::chrono::duration<Rep, Period>& timeout) {
+            return WaitUntil(latch, std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout));
+        }
+
+        /// Returns the amount of worker threads of the pool
+        std::size_t GetThreadCount() const;
+
+        /*!
+         * \brief Returns whether tasks of a higher priority than the one of the calling thread (see \ref TaskPriorityScope)
+         *        are waiting to be picked up.
+         *
+         * Long-running tasks of a lower priority can check it to return at a boundary of their work, after queuing a task that
+         * resumes it, so that the tasks of the higher priority are run first.
+         */
+        bool ShouldYield() const;
+
+        /*!
+         * \brief Returns a snapshot of the counters of the pool, collected since it was started.
+         *
+         * The counters are read one by one while the pool keeps running, so they can be slightly inconsistent with each other.
+         */
+        ThreadPoolStatistics GetStatistics() const;
     private:
-        /// A virtual class to allow storing multiple specialized \ref TaskContainerBase in the same queue
-        class TaskContainerBase {
-        public:
-            virtual ~TaskContainerBase() = default;
-            virtual void Execute() = 0;
+        /// A per-thread pool of \ref Task slots, defined in the source file
+        class TaskSlab;
+
+        /// A type-erased task, stored in a slot of a \ref TaskSlab
+        struct Task {
+            /// Runs the callable stored in the task, then destroys it
+            void (*Run)(Task& task) = nullptr;
+            /// The next task in the injection queue, or in the free list of the slab while the task is unused
+            Task* Next = nullptr;
+            /// The slab the task has to be given back to once it has run
+            TaskSlab* Slab = nullptr;
+            /// The lane of the task
+            TaskPriority Priority = TaskPriority::NORMAL;
+            /// The latch counting the task, if any, so that the threads waiting on it only help with its own tasks
+            const TaskLatch* Latch = nullptr;
+            /// When the task was queued, to measure how long it waits to be started
+            std::chrono::steady_clock::time_point SubmitTime;
+            /// The callable of the task, or a pointer to it if it doesn't fit
+            alignas(std::max_align_t) std::byte Storage[c_TaskStorageSize];
         };
 
+        /// Takes a task slot from the slab of the calling thread
+        static Task* AllocateTask();
+
+        /// Gives a task slot back to its slab. Can be called from any thread.
+        static void FreeTask(Task* task);
+
         template <typename F>
-        /// A simple wrapper around a task that allows executing it
-        class TaskContainer : public TaskContainerBase {
-        public:
-            TaskContainer(F&& func) 
-                : mFunction(std::forward<F>(func)) 
-            {}
-
-            /// Runs the task stored in the container
-            void Execute() override {
-                mFunction();
-            }
+        /// Stores the callable in a task slot and queues it, counted by the specified latch if any
+        void Submit(F&& function, const TaskLatch* latch = nullptr);
+
+        /// A thread started with a specific stack size and core, defined in the source file
+        class WorkerThread;
+
+        /// The live counters behind a \ref ThreadPoolThreadStatistics
+        struct ThreadCounters {
+            std::atomic<std::uint64_t> ExecutedTasks = 0;
+            std::atomic<std::uint64_t> StolenTasks = 0;
+            std::atomic<std::uint64_t> InjectedTasks = 0;
+            std::atomic<std::uint64_t> Sleeps = 0;
+            std::atomic<std::int64_t> BusyNanoseconds = 0;
+            std::atomic<std::int64_t> IdleNanoseconds = 0;
+            std::atomic<std::size_t> MaxQueuedTasks = 0;
+            std::array<std::atomic<std::uint64_t>, c_TaskLatencyBucketCount> TaskLatencies {};
 
-        private:
-            F mFunction;
+            /// Returns a snapshot of the counters
+            ThreadPoolThreadStatistics GetSnapshot() const;
         };
 
-        template <typename F>
-        static std::unique_ptr<TaskContainerBase> AllocateTaskContainer(F&& function) {
-            return std::unique_ptr<TaskContainerBase>(
-                new TaskContainer<F>(std::forward<F>(function))
-            );
-        }
+        /// The state of a worker thread
+        struct Worker {
+            /// The normal tasks queued by the tasks running on this worker
+            WorkStealingDeque<Task*> Tasks;
+            /// The thread running the worker
+            std::unique_ptr<WorkerThread> Thread;
+            /// The counters of the worker, only updated by its thread
+            ThreadCounters Counters;
+        };
+
+        /// Queues a normal task on the deque of the calling worker thread, or on the injection queue if called from any other thread or if it is a background task
+        void SubmitTask(Task* task);
+
+        /// The loop of a worker thread: runs tasks until the thread pool is destroyed and no tasks are left
+        void RunWorker(std::size_t workerIndex);
+
+        /*!
+         * \brief Takes the next task for the specified worker to run (or for a thread that is not a worker, if the index is out of range),
+         *        or returns nullptr if none was found. Only looks at the lanes up to \p lowestPriority.
+         */
+        Task* FindTask(std::size_t workerIndex, Xoshiro256& randomGenerator, TaskPriority lowestPriority, ThreadCounters& counters);
+
+        /// Takes the next task for the specified thread to run while waiting on the latch (see \ref Wait), or returns nullptr if none was found
+        Task* FindLatchTask(std::size_t workerIndex, const TaskLatch& latch, ThreadCounters& counters);
 
-        /// A list of all running worker threads managed by this 
-        std::vector<std::thread> mThreads;
-        /// The task queue of the thread pool
-        std::queue<std::unique_ptr<TaskContainerBase>> mTasks;
-        /// A mutex for safe accessing the mTasks member across threads
-        std::mutex mTaskMutex;
-        /// A condition variable to notify/wake up threads when tasks are available for them to pick up
-        std::condition_variable mTasksConditionVariable;
-        /// Represents if the threads of this pool are being stopped (ex. due to the pool being destroyed). Will prevent threads from picking up new tasks.
-        bool mThreadsStopping = false;
+        /// Runs a task taken from a queue, and frees it. Returns when the task ended.
+        std::chrono::steady_clock::time_point RunTask(Task* task, ThreadCounters& counters, std::chrono::steady_clock::time_point startTime);
+
+        /// Implementation of \ref Wait and \ref WaitFor
+        bool WaitUntil(const TaskLatch& latch, std::chrono::steady_clock::time_point deadline);
+
+        /// Takes the first task of a lane of the injection queue (the first one counted by the latch, if specified), or returns nullptr if there is none
+        Task* PopInjectedTask(TaskPriority priority, const TaskLatch* latch = nullptr);
+
+        /// The worker threads managed by this thread pool
+        std::vector<std::unique_ptr<Worker>> mWorkers;
+        /// A lane of the tasks queued from threads that are not worker threads of this pool
+        struct InjectionQueue {
+            /// The first task of the lane, linked to the others through \ref Task::Next
+            Task* Head = nullptr;
+            /// The last task of the lane
+            Task* Tail = nullptr;
+            /// The amount of tasks in the lane, to look for injected tasks without locking
+            std::atomic<std::size_t> Count = 0;
+        };
+
+        /// The tasks queued from threads that are not worker threads of this pool, per priority
+        std::array<InjectionQueue, c_TaskPriorityCount> mInjectedTasks;
+        /// Guards the injection queue
+        std::mutex mInjectedTasksMutex;
+        /// The amount of queued tasks that no worker has taken yet
+        std::atomic<std::int64_t> mPendingTaskCount = 0;
+        /// The amount of queued tasks that no worker has taken yet, per priority
+        std::array<std::atomic<std::int64_t>, c_TaskPriorityCount> mPendingTaskCountsByPriority {};
+        /// The counters of the threads helping while waiting, combined
+        ThreadCounters mHelperCounters;
+        /// The amount of tasks queued
+        std::atomic<std::uint64_t> mQueuedTaskCount = 0;
+        /// The most tasks mPendingTaskCount ever held
+        std::atomic<std::int64_t> mMaxPendingTaskCount = 0;
+        /// The amount of times the injection queue was locked by another thread when trying to access it
+        std::atomic<std::uint64_t> mInjectionQueueContentions = 0;
+        /// The amount of worker threads waiting on mWakeConditionVariable
+        std::atomic<std::size_t> mSleepingWorkerCount = 0;
+        /// Guards the sleep of the worker threads
+        std::mutex mSleepMutex;
+        /// A condition variable to wake up sleeping worker threads when tasks are available for them to pick up
+        std::condition_variable mWakeConditionVariable;
+        /// Represents if the threads of this pool are being stopped (ex. due to the pool being destroyed). Threads return once no tasks are left.
+        std::atomic<bool> mThreadsStopping = false;
     };
 
+    template <typename F>
+    void ThreadPool::Submit(F&& function, const TaskLatch* latch) {
+        using Function = std::decay_t<F>;
+        Task* task = AllocateTask();
+        if constexpr (sizeof(Function) <= c_TaskStorageSize && alignof(Function) <= alignof(std::max_align_t)) {
+            new (task->Storage) Function(std::forward<F>(function));
+            task->Run = [](Task& task) {
+                Function& storedFunction = *std::launder(reinterpret_cast<Function*>(task.Storage));
+                storedFunction();
+                storedFunction.~Function();
+            };
+        } else {
+            new (task->Storage) Function*(new Function(std::forward<F>(function)));
+            task->Run = [](Task& task) {
+                const std::unique_ptr<Function> storedFunction { *std::launder(reinterpret_cast<Function**>(task.Storage)) };
+                (*storedFunction)();
+            };
+        }
+        task->Latch = latch;
+        SubmitTask(task);
+    }
+
     template <typename F>
     auto ThreadPool::Execute(F function) {
         static_assert(!std::is_function_v<F>, "ThreadPool::Execute function type needs to be callable.");
 
-        std::unique_lock queueLock{ mTaskMutex, std::defer_lock };
-        std::packaged_task<std::invoke_result_t<F>()> packagedTask{ std::bind(function) };
+        std::packaged_task<std::invoke_result_t<F>()> packagedTask{ std::move(function) };
         std::future<std::invoke_result_t<F>> future = packagedTask.get_future();
+        Submit(std::move(packagedTask));
+        return future;
+    }
+
+    template <typename F>
+    auto ThreadPool::Execute(F function, const StopToken& stopToken) {
+        using Result = std::invoke_result_t<F>;
+        static_assert(std::is_void_v<Result> || std::is_default_constructible_v<Result>, "The result of tasks that can be dropped needs to be default-constructible.");
+
+        return Execute([function = std::move(function), stopToken]() mutable -> Result {
+            if (stopToken.StopRequested()) {
+                return Result();
+            }
+            return function();
+        });
+    }
 
-        queueLock.lock();
-        mTasks.emplace(AllocateTaskContainer(std::move(packagedTask)));
-        queueLock.unlock();
+    template <typename F>
+    void ThreadPool::Execute(F function, TaskLatch& latch) {
+        static_assert(!std::is_function_v<F>, "ThreadPool::Execute function type needs to be callable.");
 
-        mTasksConditionVariable.notify_one();
+        latch.Add();
+        Submit([function = std::move(function), &latch]() mutable {
+            function();
+            latch.CountDown();
+        }, &latch);
+    }
 
-        return std::move(future);
+    template <typename F>
+    void ThreadPool::Execute(F function, TaskLatch& latch, const StopToken& stopToken) {
+        Execute([function = std::move(function), stopToken]() mutable {
+            if (!stopToken.StopRequested()) {
+                function();
+            }
+        }, latch);
+    }
+
+    template <typename F>
+    void ThreadPool::ParallelFor(std::size_t begin, std::size_t end, F function, std::size_t grainSize) {
+        if (begin >= end) {
+            return;
+        }
+        // A few chunks per thread, so that threads that finish early can steal the chunks of the others
+        const std::size_t indexCount = end - begin;
+        const std::size_t maxChunkCount = (mWorkers.size() + 1) * 4;
+        const std::size_t chunkSize = std::max({ grainSize, std::size_t{ 1 }, (indexCount + maxChunkCount - 1) / maxChunkCount });
+
+        TaskLatch latch;
+        for (std::size_t chunkBegin = begin + chunkSize; chunkBegin < end; chunkBegin += chunkSize) {
+            const std::size_t chunkEnd = std::min(chunkBegin + chunkSize, end);
+            Execute([&function, chunkBegin, chunkEnd]() {
+                for (std::size_t i = chunkBegin; i < chunkEnd; i++) {
+                    function(i);
+                }
+            }, latch);
+        }
+
+        // The first chunk is run right away by the calling thread
+        for (std::size_t i = begin; i < std::min(begin + chunkSize, end); i++) {
+            function(i);
+        }
+        Wait(latch);
     }
 }
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Alphalcazar::Utils {
+	/*!
+	 * \brief The amount of buckets of the task latency histograms of \ref ThreadPoolThreadStatistics.
+	 *
+	 * Bucket 0 counts the tasks that started less than 1us after being queued, bucket i the ones that started between
+	 * 2^(i-1)us and 2^i us after, and the last bucket all slower ones (from about 4s).
+	 */
+	constexpr std::size_t c_TaskLatencyBucketCount = 24;
+
+	/// Counters of a thread that ran tasks of a \ref ThreadPool, see \ref ThreadPool::GetStatistics
+	struct ThreadPoolThreadStatistics {
+		/// The amount of tasks run, counted as they start
+		std::uint64_t ExecutedTasks = 0;
+		/// The amount of tasks taken from the deque of another worker
+		std::uint64_t StolenTasks = 0;
+		/// The amount of tasks taken from the injection queue (queued by threads that are not workers)
+		std::uint64_t InjectedTasks = 0;
+		/// The amount of times the thread went to sleep because no task was queued anywhere. Only counted for workers.
+		std::uint64_t Sleeps = 0;
+		/// The time spent running tasks
+		std::chrono::nanoseconds BusyTime { 0 };
+		/// The time spent looking for tasks or sleeping. Only counted for workers.
+		std::chrono::nanoseconds IdleTime { 0 };
+		/// The most tasks the deque of the worker held at once. Only counted for workers.
+		std::size_t MaxQueuedTasks = 0;
+		/// Histogram of the time between queuing the tasks and the thread starting them (see \ref c_TaskLatencyBucketCount)
+		std::array<std::uint64_t, c_TaskLatencyBucketCount> TaskLatencies {};
+	};
+
+	/// A snapshot of the counters of a \ref ThreadPool, see \ref ThreadPool::GetStatistics
+	struct ThreadPoolStatistics {
+		/// The counters of every worker thread
+		std::vector<ThreadPoolThreadStatistics> Workers;
+		/// The counters of the threads that ran tasks while waiting on them (see \ref ThreadPool::Wait), combined
+		ThreadPoolThreadStatistics Helpers;
+		/// The amount of tasks queued
+		std::uint64_t QueuedTasks = 0;
+		/// The most tasks that were queued at once without being started yet, over all workers and the injection queue
+		std::size_t MaxPendingTasks = 0;
+		/// The amount of times a thread had to wait for another one to access the injection queue
+		std::uint64_t InjectionQueueContentions = 0;
+
+		/// Returns the counters of all workers and helpers added up (with the highest \ref ThreadPoolThreadStatistics::MaxQueuedTasks)
+		ThreadPoolThreadStatistics GetTotal() const;
+
+		/*!
+		 * \brief Returns the latency under which at least the specified fraction (from 0 to 1) of the tasks started, rounded up
+		 *        to the upper bound of its histogram bucket. Returns 0 if no task was run.
+		 */
+		std::chrono::microseconds GetTaskLatencyPercentile(double fraction) const;
+	};
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace Alphalcazar::Utils {
+	/*!
+	 * \brief A lock-free, growable Chase-Lev work-stealing deque.
+	 *
+	 * A single owner thread pushes and pops items at the bottom of the deque (LIFO), while any other thread can
+	 * steal items from the top (FIFO). The owner only synchronizes with thieves when the deque has one item left,
+	 * so pushing and popping cost a few plain loads and stores.
+	 *
+	 * Follows "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê, Pop, Cohen, Zappa Nardelli, 2013).
+	 * The buffers replaced when the deque grows are kept until the deque is destroyed, as thieves may still be reading them.
+	 *
+	 * \note The item type must be trivially copyable (typically a pointer), as items are stored in atomics.
+	 */
+	template<typename T>
+	class WorkStealingDeque {
+		static_assert(std::is_trivially_copyable_v<T>, "Items of a WorkStealingDeque must be trivially copyable");
+	public:
+		/// Creates an empty deque. The capacity grows as needed, it is only the initial one (rounded up to a power of two).
+		explicit WorkStealingDeque(std::size_t capacity = 256) {
+			std::size_t powerOfTwoCapacity = 1;
+			while (powerOfTwoCapacity < capacity) {
+				powerOfTwoCapacity *= 2;
+			}
+			mBuffers.emplace_back(std::make_unique<Buffer>(powerOfTwoCapacity));
+			mBuffer.store(mBuffers.back().get(), std::memory_order_relaxed);
+		}
+
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+		/// Adds an item at the bottom of the deque. Can only be called by the owner thread.
+		void Push(T item) {
+			const std::int64_t bottom = mBottom.load(std::memory_order_relaxed);
+			const std::int64_t top = mTop.load(std::memory_order_acquire);
+			Buffer* buffer = mBuffer.load(std::memory_order_relaxed);
+			if (bottom - top > static_cast<std::int64_t>(buffer->Capacity) - 1) {
+				buffer = Grow(buffer, bottom, top);
+			}
+			buffer->Put(bottom, item);
+			std::atomic_thread_fence(std::memory_order_release);
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		/// Removes the item at the bottom of the deque (the last pushed one). Can only be called by the owner thread.
+		std::optional<T> Pop() {
+			const std::int64_t bottom = mBottom.load(std::memory_order_relaxed) - 1;
+			Buffer* buffer = mBuffer.load(std::memory_order_relaxed);
+			mBottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			std::int64_t top = mTop.load(std::memory_order_relaxed);
+
+			if (top > bottom) {
+				// The deque was empty
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+				return std::nullopt;
+			}
+			std::optional<T> item = buffer->Get(bottom);
+			if (top == bottom) {
+				// Last item, which a thief might be stealing at the same time
+				if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+					item = std::nullopt;
+				}
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			return item;
+		}
+
+		/*!
+		 * \brief Removes the item at the top of the deque (the first pushed one). Can be called by any thread.
+		 *
+		 * Returns nothing if the deque is empty, or if another thread took the item first.
+		 */
+		std::optional<T> Steal() {
+			std::int64_t top = mTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const std::int64_t bottom = mBottom.load(std::memory_order_acquire);
+			if (top >= bottom) {
+				return std::nullopt;
+			}
+
+			const Buffer* buffer = mBuffer.load(std::memory_order_acquire);
+			const T item = buffer->Get(top);
+			if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+				return std::nullopt;
+			}
+			return item;
+		}
+
+		/// Returns an estimate of the amount of items in the deque, which may be outdated by the time it is used
+		std::size_t ApproximateSize() const {
+			const std::int64_t bottom = mBottom.load(std::memory_order_relaxed);
+			const std::int64_t top = mTop.load(std::memory_order_relaxed);
+			return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+		}
+	private:
+		/// A circular array of items, indexed by the ever-growing top and bottom indices of the deque
+		struct Buffer {
+			explicit Buffer(std::size_t capacity)
+				: Capacity { capacity }
+				, Items { std::make_unique<std::atomic<T>[]>(capacity) }
+			{}
+
+			T Get(std::int64_t index) const {
+				return Items[static_cast<std::size_t>(index) & (Capacity - 1)].load(std::memory_order_relaxed);
+			}
+
+			void Put(std::int64_t index, T item) {
+				Items[static_cast<std::size_t>(index) & (Capacity - 1)].store(item, std::memory_order_relaxed);
+			}
+
+			std::size_t Capacity;
+			std::unique_ptr<std::atomic<T>[]> Items;
+		};
+
+		/// Replaces the buffer with one twice as big, holding the same items
+		Buffer* Grow(const Buffer* buffer, std::int64_t bottom, std::int64_t top) {
+			auto biggerBuffer = std::make_unique<Buffer>(buffer->Capacity * 2);
+			for (std::int64_t i = top; i < bottom; i++) {
+				biggerBuffer->Put(i, buffer->Get(i));
+			}
+			Buffer* newBuffer = biggerBuffer.get();
+			mBuffers.emplace_back(std::move(biggerBuffer));
+			mBuffer.store(newBuffer, std::memory_order_release);
+			return newBuffer;
+		}
+
+		/// The index of the next item to steal. Only ever increases.
+		alignas(64) std::atomic<std::int64_t> mTop = 0;
+		/// The index past the last pushed item
+		alignas(64) std::atomic<std::int64_t> mBottom = 0;
+		/// The buffer currently holding the items
+		std::atomic<Buffer*> mBuffer = nullptr;
+		/// All buffers the deque ever used (including the current one), only accessed by the owner thread
+		std::vector<std::unique_ptr<Buffer>> mBuffers;
+	};
+}
@@ -0,0 +1,76 @@
+#include "util/CpuTopology.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace Alphalcazar::Utils {
+	namespace {
+		/// Parses a list of cores in the format used by Linux, such as "0-3,8,10-11"
+		std::vector<std::size_t> ParseCoreList(const std::string& coreList) {
+			std::vector<std::size_t> cores;
+			std::size_t position = 0;
+			while (position < coreList.size()) {
+				std::size_t rangeEnd = coreList.find(',', position);
+				if (rangeEnd == std::string::npos) {
+					rangeEnd = coreList.size();
+				}
+				const std::string range = coreList.substr(position, rangeEnd - position);
+				const std::size_t dash = range.find('-');
+				const std::size_t first = static_cast<std::size_t>(std::strtoull(range.c_str(), nullptr, 10));
+				const std::size_t last = dash == std::string::npos ? first : static_cast<std::size_t>(std::strtoull(range.c_str() + dash + 1, nullptr, 10));
+				for (std::size_t core = first; core <= last; core++) {
+					cores.push_back(core);
+				}
+				position = rangeEnd + 1;
+			}
+			return cores;
+		}
+	}
+
+	std::vector<NumaNode> GetNumaNodes() {
+		std::vector<NumaNode> nodes;
+#if defined(__linux__)
+		// Node indices can have gaps (ex. offline nodes), so a few missing nodes don't end the lookup
+		constexpr std::size_t c_MaxMissingNodes = 8;
+		for (std::size_t nodeIndex = 0, missingNodes = 0; missingNodes < c_MaxMissingNodes; nodeIndex++) {
+			std::ifstream coreListFile { "/sys/devices/system/node/node" + std::to_string(nodeIndex) + "/cpulist" };
+			std::string coreList;
+			if (!coreListFile || !std::getline(coreListFile, coreList)) {
+				missingNodes++;
+				continue;
+			}
+			NumaNode node { ParseCoreList(coreList) };
+			if (!node.Cores.empty()) {
+				nodes.emplace_back(std::move(node));
+			}
+		}
+#endif
+		if (nodes.empty()) {
+			NumaNode node;
+			for (std::size_t core = 0; core < std::max(std::thread::hardware_concurrency(), 1U); core++) {
+				node.Cores.push_back(core);
+			}
+			nodes.emplace_back(std::move(node));
+		}
+		return nodes;
+	}
+
+	std::vector<std::size_t> GetNumaSpreadCores() {
+		const std::vector<NumaNode> nodes = GetNumaNodes();
+		std::vector<std::size_t> cores;
+		for (std::size_t coreIndex = 0; ; coreIndex++) {
+			const std::size_t coreCount = cores.size();
+			for (const auto& node : nodes) {
+				if (coreIndex < node.Cores.size()) {
+					cores.push_back(node.Cores[coreIndex]);
+				}
+			}
+			if (cores.size() == coreCount) {
+				return cores;
+			}
+		}
+	}
+}
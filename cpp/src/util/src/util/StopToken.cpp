@@ -0,0 +1,41 @@
+#include "util/StopToken.hpp"
+
+namespace Alphalcazar::Utils {
+	StopToken::StopToken(Clock::time_point deadline)
+		: mState { std::make_shared<State>() }
+	{
+		mState->Deadline = deadline;
+	}
+
+	void StopToken::RequestStop() const {
+		mState->Stopped.store(true, std::memory_order_relaxed);
+	}
+
+	bool StopToken::CheckDeadline() const {
+		return CheckDeadline(*mState);
+	}
+
+	void StopToken::Follow(const StopToken& other) const {
+		mState->Followed = other.mState;
+		mState->FollowedState.store(mState->Followed.get(), std::memory_order_release);
+	}
+
+	bool StopToken::CheckDeadline(State& state) {
+		if (!state.Stopped.load(std::memory_order_relaxed)) {
+			const bool deadlinePassed = state.Deadline != Clock::time_point::max() && Clock::now() >= state.Deadline;
+			State* followedState = state.FollowedState.load(std::memory_order_acquire);
+			if (deadlinePassed || (followedState && CheckDeadline(*followedState))) {
+				state.Stopped.store(true, std::memory_order_relaxed);
+			}
+		}
+		return state.Stopped.load(std::memory_order_relaxed);
+	}
+
+	bool StopToken::HasDeadline() const {
+		return mState->Deadline != Clock::time_point::max();
+	}
+
+	StopToken::Clock::time_point StopToken::GetDeadline() const {
+		return mState->Deadline;
+	}
+}
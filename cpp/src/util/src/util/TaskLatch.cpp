@@ -0,0 +1,44 @@
+#include "util/TaskLatch.hpp"
+
+#include <cassert>
+
+namespace Alphalcazar::Utils {
+	TaskLatch::TaskLatch(std::size_t count)
+		: mCount { count }
+	{}
+
+	void TaskLatch::Add(std::size_t count) {
+		mCount.fetch_add(count, std::memory_order_relaxed);
+	}
+
+	void TaskLatch::CountDown() {
+		std::size_t count = mCount.load(std::memory_order_relaxed);
+		while (count > 1) {
+			if (mCount.compare_exchange_weak(count, count - 1, std::memory_order_release, std::memory_order_relaxed)) {
+				return;
+			}
+		}
+
+		// Possibly the last task: the waiters check the count under the lock, so they can't see it reach zero before being notified
+		std::lock_guard lock { mMutex };
+		const std::size_t previousCount = mCount.fetch_sub(1, std::memory_order_acq_rel);
+		assert(previousCount > 0);
+		if (previousCount == 1) {
+			mDoneConditionVariable.notify_all();
+		}
+	}
+
+	bool TaskLatch::IsDone() const {
+		if (mCount.load(std::memory_order_acquire) != 0) {
+			return false;
+		}
+		// Wait for the last count down to release the lock, so that the latch can be destroyed right away
+		std::lock_guard lock { mMutex };
+		return true;
+	}
+
+	void TaskLatch::Wait() const {
+		std::unique_lock lock { mMutex };
+		mDoneConditionVariable.wait(lock, [this]() { return mCount.load(std::memory_order_acquire) == 0; });
+	}
+}
@@ -1,39 +1,557 @@
 #include "util/ThreadPool.hpp"
 
+#include "util/Log.hpp"
+#include "util/Random.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <optional>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 namespace Alphalcazar::Utils {
-    ThreadPool::ThreadPool(size_t threadCount) {
-        mThreads.reserve(threadCount);
-        for (size_t i = 0; i < threadCount; i++) {
-            mThreads.emplace_back(
-                [this]() {
-                    std::unique_lock queueLock{ mTaskMutex, std::defer_lock };
+    namespace {
+        /// The thread pool the current thread is a worker of, if any
+        thread_local const ThreadPool* tl_WorkerPool = nullptr;
+        /// The index of the worker the current thread runs in tl_WorkerPool
+        thread_local std::size_t tl_WorkerIndex = 0;
+        /// The priority of the tasks queued by the current thread
+        thread_local TaskPriority tl_TaskPriority = TaskPriority::NORMAL;
 
-                    while (true) {
-                        queueLock.lock();
-                        mTasksConditionVariable.wait(queueLock, [this]() -> bool {
-                            return !mTasks.empty() || mThreadsStopping;
-                        });
+        /// The amount of times an idle worker looks for tasks again, yielding in between, before going to sleep
+        constexpr std::size_t c_IdleSpinCount = 64;
+        /// The longest a thread helping while waiting on a latch sleeps before looking for tasks to run again
+        constexpr std::chrono::microseconds c_HelpPollInterval { 100 };
+        /// The amount of task slots a slab allocates at once when it runs out of them
+        constexpr std::size_t c_TaskSlabChunkSize = 64;
 
-                        if (mThreadsStopping && mTasks.empty()) return;
+        /// Returns the bucket of the task latency histograms (see \ref c_TaskLatencyBucketCount) the latency falls in
+        std::size_t GetTaskLatencyBucket(std::chrono::steady_clock::duration latency) {
+            auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+            std::size_t bucket = 0;
+            while (microseconds > 0 && bucket + 1 < c_TaskLatencyBucketCount) {
+                microseconds >>= 1;
+                bucket++;
+            }
+            return bucket;
+        }
+
+        /// Raises the value to the specified one if it is lower
+        template<typename T>
+        void UpdateMax(std::atomic<T>& maxValue, T value) {
+            T currentMaxValue = maxValue.load(std::memory_order_relaxed);
+            while (value > currentMaxValue && !maxValue.compare_exchange_weak(currentMaxValue, value, std::memory_order_relaxed)) {}
+        }
+    }
+
+    /*!
+     * \brief The task slots of a thread, allocated in chunks and reused once the tasks have run.
+     *
+     * Only the owner thread takes slots. Slots freed by the owner go back to its free list directly, and slots freed by
+     * other threads (the workers that ran the tasks) are pushed to a lock-free list that the owner takes over as a whole
+     * once its own list is empty, so no slot is ever popped concurrently.
+     *
+     * The slab is deleted once its thread has exited and all of its slots have been given back.
+     */
+    class ThreadPool::TaskSlab {
+    public:
+        Task* Allocate() {
+            if (!mFreeTasks) {
+                mFreeTasks = mRemotelyFreedTasks.exchange(nullptr, std::memory_order_acquire);
+            }
+            if (!mFreeTasks) {
+                auto& chunk = mChunks.emplace_back(std::make_unique<Task[]>(c_TaskSlabChunkSize));
+                for (std::size_t i = 0; i < c_TaskSlabChunkSize; i++) {
+                    chunk[i].Next = i + 1 < c_TaskSlabChunkSize ? &chunk[i + 1] : nullptr;
+                }
+                mFreeTasks = &chunk[0];
+            }
+
+            Task* task = mFreeTasks;
+            mFreeTasks = task->Next;
+            task->Next = nullptr;
+            task->Slab = this;
+            mReferenceCount.fetch_add(1, std::memory_order_relaxed);
+            return task;
+        }
+
+        void Free(Task* task, bool ownerThread) {
+            if (ownerThread) {
+                task->Next = mFreeTasks;
+                mFreeTasks = task;
+            } else {
+                Task* head = mRemotelyFreedTasks.load(std::memory_order_relaxed);
+                do {
+                    task->Next = head;
+                } while (!mRemotelyFreedTasks.compare_exchange_weak(head, task, std::memory_order_release, std::memory_order_relaxed));
+            }
+            Release();
+        }
 
-                        const std::unique_ptr<TaskContainerBase> task = std::move(mTasks.front());
+        /// Drops a reference to the slab (held by its owner thread and by each of the slots in use), deleting it with the last one
+        void Release() {
+            if (mReferenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete this;
+            }
+        }
+    private:
+        /// The memory of all slots of the slab
+        std::vector<std::unique_ptr<Task[]>> mChunks;
+        /// The free slots, only accessed by the owner thread
+        Task* mFreeTasks = nullptr;
+        /// The slots freed by other threads
+        std::atomic<Task*> mRemotelyFreedTasks = nullptr;
+        /// The owner thread, plus the amount of slots in use
+        std::atomic<std::size_t> mReferenceCount = 1;
+    };
+
+    namespace {
+        /// The slab owned by the current thread, if any. Only compared against, and trivial so that it can be read even as the thread exits.
+        thread_local const void* tl_OwnedTaskSlab = nullptr;
+    }
+
+    ThreadPool::Task* ThreadPool::AllocateTask() {
+        // The slab of a thread is created with its first task, and released when the thread exits
+        struct TaskSlabOwner {
+            TaskSlabOwner() {
+                tl_OwnedTaskSlab = Slab;
+            }
+            ~TaskSlabOwner() {
+                tl_OwnedTaskSlab = nullptr;
+                Slab->Release();
+            }
+            TaskSlab* Slab = new TaskSlab();
+        };
+        thread_local TaskSlabOwner slabOwner;
+        return slabOwner.Slab->Allocate();
+    }
+
+    void ThreadPool::FreeTask(Task* task) {
+        task->Slab->Free(task, task->Slab == tl_OwnedTaskSlab);
+    }
+
+    /*!
+     * \brief A thread started with the native API of the platform, which unlike std::thread allows setting its stack size
+     *        and pinning it to a core before it starts running.
+     *
+     * Pinning is only supported on Linux and Windows, and is skipped (with a warning) if the core doesn't exist.
+     */
+    class ThreadPool::WorkerThread {
+    public:
+        WorkerThread(std::function<void()> function, std::size_t stackSize, std::optional<std::size_t> core)
+            : mFunction { std::move(function) }
+        {
+#if defined(_WIN32)
+            // Started suspended, so that it is pinned before it runs
+            mHandle = CreateThread(nullptr, stackSize, &WorkerThread::Run, this, CREATE_SUSPENDED | (stackSize > 0 ? STACK_SIZE_PARAM_IS_A_RESERVATION : 0), nullptr);
+            if (!mHandle) {
+                LogError("Could not start a thread pool worker (error {})", GetLastError());
+                std::abort();
+            }
+            if (core && (*core >= sizeof(DWORD_PTR) * 8 || !SetThreadAffinityMask(mHandle, DWORD_PTR{ 1 } << *core))) {
+                LogWarn("Could not pin a thread pool worker to core {}", *core);
+            }
+            ResumeThread(mHandle);
+#else
+            int error = Start(stackSize, core);
+            if (error != 0 && core) {
+                // The core may not exist or not be available to the process
+                LogWarn("Could not pin a thread pool worker to core {}", *core);
+                error = Start(stackSize, std::nullopt);
+            }
+            if (error != 0) {
+                LogError("Could not start a thread pool worker (error {})", error);
+                std::abort();
+            }
+#endif
+        }
+
+        WorkerThread(const WorkerThread&) = delete;
+        WorkerThread& operator=(const WorkerThread&) = delete;
+
+        /// Waits for the function of the thread to return
+        void Join() {
+#if defined(_WIN32)
+            WaitForSingleObject(mHandle, INFINITE);
+            CloseHandle(mHandle);
+#else
+            pthread_join(mHandle, nullptr);
+#endif
+        }
+    private:
+#if defined(_WIN32)
+        static DWORD WINAPI Run(LPVOID thread) {
+            static_cast<WorkerThread*>(thread)->mFunction();
+            return 0;
+        }
 
-                        mTasks.pop();
-                        queueLock.unlock();
+        HANDLE mHandle = nullptr;
+#else
+        static void* Run(void* thread) {
+            static_cast<WorkerThread*>(thread)->mFunction();
+            return nullptr;
+        }
 
-                        task->Execute();
-                    }
+        /// Starts the thread with the specified attributes, returning the error code of pthread_create
+        int Start(std::size_t stackSize, std::optional<std::size_t> core) {
+            pthread_attr_t attributes;
+            pthread_attr_init(&attributes);
+            if (stackSize > 0) {
+                // The stack size must be a multiple of the page size on some platforms
+                const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+                const std::size_t pageAlignedStackSize = (stackSize + pageSize - 1) / pageSize * pageSize;
+                if (pthread_attr_setstacksize(&attributes, std::max<std::size_t>(pageAlignedStackSize, PTHREAD_STACK_MIN)) != 0) {
+                    LogWarn("Could not set the stack size of a thread pool worker to {} bytes", stackSize);
                 }
-            );
+            }
+#if defined(__linux__)
+            if (core && *core < CPU_SETSIZE) {
+                cpu_set_t cores;
+                CPU_ZERO(&cores);
+                CPU_SET(*core, &cores);
+                pthread_attr_setaffinity_np(&attributes, sizeof(cores), &cores);
+            }
+#endif
+            const int error = pthread_create(&mHandle, &attributes, &WorkerThread::Run, this);
+            pthread_attr_destroy(&attributes);
+            return error;
+        }
+
+        pthread_t mHandle;
+#endif
+        /// The function run by the thread
+        std::function<void()> mFunction;
+    };
+
+    ThreadPool::ThreadPool(size_t threadCount)
+        : ThreadPool(ThreadPoolOptions { threadCount, false, {}, 0 })
+    {}
+
+    ThreadPool::ThreadPool(const ThreadPoolOptions& options) {
+        // All deques must exist before any worker starts stealing from them
+        mWorkers.reserve(options.ThreadCount);
+        for (size_t i = 0; i < options.ThreadCount; i++) {
+            mWorkers.emplace_back(std::make_unique<Worker>());
+        }
+
+        std::vector<std::size_t> cores;
+        if (options.PinThreads) {
+            cores = options.Cores.empty() ? GetNumaSpreadCores() : options.Cores;
+        }
+        for (size_t i = 0; i < options.ThreadCount; i++) {
+            const std::optional<std::size_t> core = cores.empty() ? std::nullopt : std::optional<std::size_t>{ cores[i % cores.size()] };
+            mWorkers[i]->Thread = std::make_unique<WorkerThread>([this, i]() { RunWorker(i); }, options.StackSize, core);
         }
     }
 
     ThreadPool::~ThreadPool() {
-        mThreadsStopping = true;
-        mTasksConditionVariable.notify_all();
+        {
+            std::lock_guard sleepLock{ mSleepMutex };
+            mThreadsStopping = true;
+        }
+        mWakeConditionVariable.notify_all();
+
+        for (auto& worker : mWorkers) {
+            worker->Thread->Join();
+        }
+    }
+
+    namespace {
+        /// The options of the shared thread pool, which can be changed until it is started
+        struct SharedThreadPoolConfiguration {
+            std::mutex Mutex;
+            ThreadPoolOptions Options { std::max(std::thread::hardware_concurrency(), 2U) - 1, false, {}, ThreadPool::c_SharedThreadPoolStackSize };
+            bool Started = false;
+        };
+
+        SharedThreadPoolConfiguration& GetSharedThreadPoolConfiguration() {
+            static SharedThreadPoolConfiguration configuration;
+            return configuration;
+        }
+    }
+
+    ThreadPool& ThreadPool::GetShared() {
+        static ThreadPool sharedThreadPool { []() {
+            auto& configuration = GetSharedThreadPoolConfiguration();
+            std::lock_guard configurationLock { configuration.Mutex };
+            configuration.Started = true;
+            return configuration.Options;
+        }() };
+        return sharedThreadPool;
+    }
+
+    bool ThreadPool::ConfigureShared(const ThreadPoolOptions& options) {
+        auto& configuration = GetSharedThreadPoolConfiguration();
+        std::lock_guard configurationLock { configuration.Mutex };
+        if (configuration.Started) {
+            return false;
+        }
+        configuration.Options = options;
+        return true;
+    }
+
+    TaskPriorityScope::TaskPriorityScope(TaskPriority priority)
+        : mPreviousPriority { tl_TaskPriority }
+    {
+        tl_TaskPriority = priority;
+    }
+
+    TaskPriorityScope::~TaskPriorityScope() {
+        tl_TaskPriority = mPreviousPriority;
+    }
+
+    TaskPriority TaskPriorityScope::GetCurrent() {
+        return tl_TaskPriority;
+    }
+
+    void ThreadPool::SubmitTask(Task* task) {
+        task->Priority = tl_TaskPriority;
+        task->SubmitTime = std::chrono::steady_clock::now();
+        const auto lane = static_cast<std::size_t>(task->Priority);
+        // Counted before being queued, so that no worker can take the task before it is counted
+        mPendingTaskCountsByPriority[lane].fetch_add(1, std::memory_order_relaxed);
+        UpdateMax(mMaxPendingTaskCount, mPendingTaskCount.fetch_add(1, std::memory_order_seq_cst) + 1);
+        mQueuedTaskCount.fetch_add(1, std::memory_order_relaxed);
+        if (tl_WorkerPool == this && task->Priority == TaskPriority::NORMAL) {
+            Worker& worker = *mWorkers[tl_WorkerIndex];
+            worker.Tasks.Push(task);
+            UpdateMax(worker.Counters.MaxQueuedTasks, worker.Tasks.ApproximateSize());
+        } else {
+            std::unique_lock injectedTasksLock{ mInjectedTasksMutex, std::try_to_lock };
+            if (!injectedTasksLock.owns_lock()) {
+                mInjectionQueueContentions.fetch_add(1, std::memory_order_relaxed);
+                injectedTasksLock.lock();
+            }
+            InjectionQueue& injectedTasks = mInjectedTasks[lane];
+            if (injectedTasks.Tail) {
+                injectedTasks.Tail->Next = task;
+            } else {
+                injectedTasks.Head = task;
+            }
+            injectedTasks.Tail = task;
+            injectedTasks.Count.fetch_add(1, std::memory_order_release);
+        }
+
+        // A worker going to sleep checks the pending tasks after announcing itself, so either it sees this task or we see it
+        if (mSleepingWorkerCount.load(std::memory_order_seq_cst) > 0) {
+            {
+                std::lock_guard sleepLock{ mSleepMutex };
+            }
+            mWakeConditionVariable.notify_one();
+        }
+    }
+
+    void ThreadPool::RunWorker(std::size_t workerIndex) {
+        tl_WorkerPool = this;
+        tl_WorkerIndex = workerIndex;
+        Xoshiro256 randomGenerator{ workerIndex };
+        ThreadCounters& counters = mWorkers[workerIndex]->Counters;
+
+        auto idleStartTime = std::chrono::steady_clock::now();
+        while (true) {
+            Task* task = FindTask(workerIndex, randomGenerator, TaskPriority::BACKGROUND, counters);
+            for (std::size_t i = 0; i < c_IdleSpinCount && !task; i++) {
+                std::this_thread::yield();
+                task = FindTask(workerIndex, randomGenerator, TaskPriority::BACKGROUND, counters);
+            }
+
+            if (task) {
+                const auto startTime = std::chrono::steady_clock::now();
+                counters.IdleNanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(startTime - idleStartTime).count(), std::memory_order_relaxed);
+                idleStartTime = RunTask(task, counters, startTime);
+                counters.BusyNanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(idleStartTime - startTime).count(), std::memory_order_relaxed);
+                continue;
+            }
+
+            counters.Sleeps.fetch_add(1, std::memory_order_relaxed);
+            std::unique_lock sleepLock{ mSleepMutex };
+            mSleepingWorkerCount.fetch_add(1, std::memory_order_seq_cst);
+            mWakeConditionVariable.wait(sleepLock, [this]() -> bool {
+                return mPendingTaskCount.load(std::memory_order_seq_cst) > 0 || mThreadsStopping;
+            });
+            mSleepingWorkerCount.fetch_sub(1, std::memory_order_relaxed);
+            if (mThreadsStopping && mPendingTaskCount.load(std::memory_order_seq_cst) <= 0) {
+                return;
+            }
+        }
+    }
+
+    void ThreadPool::Wait(const TaskLatch& latch) {
+        WaitUntil(latch, std::chrono::steady_clock::time_point::max());
+    }
+
+    std::size_t ThreadPool::GetThreadCount() const {
+        return mWorkers.size();
+    }
+
+    bool ThreadPool::ShouldYield() const {
+        for (std::size_t lane = 0; lane < static_cast<std::size_t>(tl_TaskPriority); lane++) {
+            if (mPendingTaskCountsByPriority[lane].load(std::memory_order_relaxed) > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ThreadPool::WaitUntil(const TaskLatch& latch, std::chrono::steady_clock::time_point deadline) {
+        // Worker threads of this pool start with their own tasks, any other thread can only take injected tasks of the latch
+        const std::size_t workerIndex = tl_WorkerPool == this ? tl_WorkerIndex : mWorkers.size();
+        // The time spent by workers on nested tasks is already counted as part of the task they are waiting from
+        const bool isWorker = workerIndex < mWorkers.size();
+        ThreadCounters& counters = isWorker ? mWorkers[workerIndex]->Counters : mHelperCounters;
+        while (!latch.IsDone()) {
+            if (Task* task = FindLatchTask(workerIndex, latch, counters)) {
+                const auto startTime = std::chrono::steady_clock::now();
+                const auto endTime = RunTask(task, counters, startTime);
+                if (!isWorker) {
+                    counters.BusyNanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count(), std::memory_order_relaxed);
+                }
+                continue;
+            }
+
+            // The remaining tasks of the latch are running on other threads, but they may still queue more tasks to help with
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                return latch.IsDone();
+            }
+            latch.WaitFor(std::min<std::chrono::steady_clock::duration>(c_HelpPollInterval, deadline - now));
+        }
+        return true;
+    }
+
+    std::chrono::steady_clock::time_point ThreadPool::RunTask(Task* task, ThreadCounters& counters, std::chrono::steady_clock::time_point startTime) {
+        mPendingTaskCountsByPriority[static_cast<std::size_t>(task->Priority)].fetch_sub(1, std::memory_order_relaxed);
+        mPendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+        counters.TaskLatencies[GetTaskLatencyBucket(startTime - task->SubmitTime)].fetch_add(1, std::memory_order_relaxed);
+        // Counted before running the task, so that a thread seeing its latch done also sees the task counted
+        counters.ExecutedTasks.fetch_add(1, std::memory_order_relaxed);
+        {
+            const TaskPriorityScope priorityScope { task->Priority };
+            task->Run(*task);
+        }
+        FreeTask(task);
+        return std::chrono::steady_clock::now();
+    }
+
+    ThreadPoolStatistics ThreadPool::GetStatistics() const {
+        ThreadPoolStatistics statistics;
+        statistics.Workers.reserve(mWorkers.size());
+        for (const auto& worker : mWorkers) {
+            statistics.Workers.push_back(worker->Counters.GetSnapshot());
+        }
+        statistics.Helpers = mHelperCounters.GetSnapshot();
+        statistics.QueuedTasks = mQueuedTaskCount.load(std::memory_order_relaxed);
+        statistics.MaxPendingTasks = static_cast<std::size_t>(mMaxPendingTaskCount.load(std::memory_order_relaxed));
+        statistics.InjectionQueueContentions = mInjectionQueueContentions.load(std::memory_order_relaxed);
+        return statistics;
+    }
 
-        for (std::thread& thread : mThreads) {
-            thread.join();
+    ThreadPoolThreadStatistics ThreadPool::ThreadCounters::GetSnapshot() const {
+        ThreadPoolThreadStatistics statistics;
+        statistics.ExecutedTasks = ExecutedTasks.load(std::memory_order_relaxed);
+        statistics.StolenTasks = StolenTasks.load(std::memory_order_relaxed);
+        statistics.InjectedTasks = InjectedTasks.load(std::memory_order_relaxed);
+        statistics.Sleeps = Sleeps.load(std::memory_order_relaxed);
+        statistics.BusyTime = std::chrono::nanoseconds { BusyNanoseconds.load(std::memory_order_relaxed) };
+        statistics.IdleTime = std::chrono::nanoseconds { IdleNanoseconds.load(std::memory_order_relaxed) };
+        statistics.MaxQueuedTasks = MaxQueuedTasks.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < c_TaskLatencyBucketCount; i++) {
+            statistics.TaskLatencies[i] = TaskLatencies[i].load(std::memory_order_relaxed);
+        }
+        return statistics;
+    }
+
+    ThreadPool::Task* ThreadPool::FindTask(std::size_t workerIndex, Xoshiro256& randomGenerator, TaskPriority lowestPriority, ThreadCounters& counters) {
+        const std::size_t workerCount = mWorkers.size();
+        for (std::size_t lane = 0; lane <= static_cast<std::size_t>(lowestPriority); lane++) {
+            if (mPendingTaskCountsByPriority[lane].load(std::memory_order_relaxed) <= 0) {
+                continue;
+            }
+            // The deques of the workers only hold normal tasks
+            const bool isNormalLane = lane == static_cast<std::size_t>(TaskPriority::NORMAL);
+            if (isNormalLane && workerIndex < workerCount) {
+                if (const auto task = mWorkers[workerIndex]->Tasks.Pop()) {
+                    return *task;
+                }
+            }
+            if (Task* task = PopInjectedTask(static_cast<TaskPriority>(lane))) {
+                counters.InjectedTasks.fetch_add(1, std::memory_order_relaxed);
+                return task;
+            }
+
+            // Try every other worker once, starting from a random one so that thieves spread over the victims
+            if (!isNormalLane || workerCount == 0) {
+                continue;
+            }
+            const std::size_t firstVictim = static_cast<std::size_t>(randomGenerator() % workerCount);
+            for (std::size_t i = 0; i < workerCount; i++) {
+                const std::size_t victim = (firstVictim + i) % workerCount;
+                if (victim == workerIndex) {
+                    continue;
+                }
+                if (const auto task = mWorkers[victim]->Tasks.Steal()) {
+                    counters.StolenTasks.fetch_add(1, std::memory_order_relaxed);
+                    return *task;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    ThreadPool::Task* ThreadPool::FindLatchTask(std::size_t workerIndex, const TaskLatch& latch, ThreadCounters& counters) {
+        // A worker runs the tasks it queued itself, which include the normal tasks of the latch it queued. Running them in
+        // any order keeps nested waits from deadlocking, as a task waited on can't get stuck under another one.
+        if (workerIndex < mWorkers.size()) {
+            if (const auto task = mWorkers[workerIndex]->Tasks.Pop()) {
+                return *task;
+            }
+        }
+        // Tasks on the deques of other workers are left to them, as they were queued by other tasks. The injected tasks of
+        // the latch are run whatever their lane, so that the thread waiting on them is never held up by other work.
+        for (std::size_t lane = 0; lane < c_TaskPriorityCount; lane++) {
+            if (mPendingTaskCountsByPriority[lane].load(std::memory_order_relaxed) <= 0) {
+                continue;
+            }
+            if (Task* task = PopInjectedTask(static_cast<TaskPriority>(lane), &latch)) {
+                counters.InjectedTasks.fetch_add(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    ThreadPool::Task* ThreadPool::PopInjectedTask(TaskPriority priority, const TaskLatch* latch) {
+        InjectionQueue& injectedTasks = mInjectedTasks[static_cast<std::size_t>(priority)];
+        if (injectedTasks.Count.load(std::memory_order_acquire) == 0) {
+            return nullptr;
+        }
+        std::unique_lock injectedTasksLock{ mInjectedTasksMutex, std::try_to_lock };
+        if (!injectedTasksLock.owns_lock()) {
+            mInjectionQueueContentions.fetch_add(1, std::memory_order_relaxed);
+            injectedTasksLock.lock();
+        }
+        Task* previousTask = nullptr;
+        Task* task = injectedTasks.Head;
+        while (task && latch && task->Latch != latch) {
+            previousTask = task;
+            task = task->Next;
+        }
+        if (!task) {
+            return nullptr;
+        }
+        (previousTask ? previousTask->Next : injectedTasks.Head) = task->Next;
+        if (injectedTasks.Tail == task) {
+            injectedTasks.Tail = previousTask;
         }
+        task->Next = nullptr;
+        injectedTasks.Count.fetch_sub(1, std::memory_order_relaxed);
+        return task;
     }
 }
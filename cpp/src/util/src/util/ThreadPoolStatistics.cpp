@@ -0,0 +1,38 @@
+#include "util/ThreadPoolStatistics.hpp"
+
+#include <algorithm>
+
+namespace Alphalcazar::Utils {
+	ThreadPoolThreadStatistics ThreadPoolStatistics::GetTotal() const {
+		ThreadPoolThreadStatistics total = Helpers;
+		for (const auto& worker : Workers) {
+			total.ExecutedTasks += worker.ExecutedTasks;
+			total.StolenTasks += worker.StolenTasks;
+			total.InjectedTasks += worker.InjectedTasks;
+			total.Sleeps += worker.Sleeps;
+			total.BusyTime += worker.BusyTime;
+			total.IdleTime += worker.IdleTime;
+			total.MaxQueuedTasks = std::max(total.MaxQueuedTasks, worker.MaxQueuedTasks);
+			for (std::size_t i = 0; i < c_TaskLatencyBucketCount; i++) {
+				total.TaskLatencies[i] += worker.TaskLatencies[i];
+			}
+		}
+		return total;
+	}
+
+	std::chrono::microseconds ThreadPoolStatistics::GetTaskLatencyPercentile(double fraction) const {
+		const ThreadPoolThreadStatistics total = GetTotal();
+		if (total.ExecutedTasks == 0) {
+			return std::chrono::microseconds { 0 };
+		}
+		const auto percentileTaskCount = static_cast<std::uint64_t>(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(total.ExecutedTasks));
+		std::uint64_t taskCount = 0;
+		for (std::size_t i = 0; i < c_TaskLatencyBucketCount; i++) {
+			taskCount += total.TaskLatencies[i];
+			if (taskCount >= std::max<std::uint64_t>(percentileTaskCount, 1)) {
+				return std::chrono::microseconds { std::int64_t { 1 } << i };
+			}
+		}
+		return std::chrono::microseconds { std::int64_t { 1 } << (c_TaskLatencyBucketCount - 1) };
+	}
+}
@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+
+#include <util/CpuTopology.hpp>
+
+#include <algorithm>
+
+namespace Alphalcazar::Utils {
+	TEST(CpuTopology, SpreadCoresCoverAllNodes) {
+		const auto nodes = GetNumaNodes();
+		ASSERT_FALSE(nodes.empty());
+		std::vector<std::size_t> nodeCores;
+		for (const auto& node : nodes) {
+			EXPECT_FALSE(node.Cores.empty());
+			nodeCores.insert(nodeCores.end(), node.Cores.begin(), node.Cores.end());
+		}
+
+		// Every core is listed once, starting with the first core of every node
+		auto spreadCores = GetNumaSpreadCores();
+		for (std::size_t i = 0; i < nodes.size(); i++) {
+			EXPECT_EQ(spreadCores[i], nodes[i].Cores[0]);
+		}
+		std::sort(spreadCores.begin(), spreadCores.end());
+		std::sort(nodeCores.begin(), nodeCores.end());
+		EXPECT_EQ(spreadCores, nodeCores);
+	}
+}
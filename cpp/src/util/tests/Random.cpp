@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <util/Random.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace Alphalcazar::Utils {
+	TEST(Random, SameSeedSameSequence) {
+		Xoshiro256 generator{ 42 };
+		Xoshiro256 sameSeedGenerator{ 42 };
+		Xoshiro256 otherSeedGenerator{ 43 };
+		bool differentSequences = false;
+		for (std::size_t i = 0; i < 100; i++) {
+			const auto value = generator();
+			EXPECT_EQ(value, sameSeedGenerator());
+			differentSequences |= value != otherSeedGenerator();
+		}
+		EXPECT_TRUE(differentSequences);
+
+		// Re-seeding restarts the sequence
+		generator.Seed(42);
+		EXPECT_EQ(generator(), Xoshiro256{ 42 }());
+	}
+
+	TEST(Random, NextBounded) {
+		Xoshiro256 generator{ 7 };
+		constexpr std::uint32_t c_Bound = 12;
+		std::array<std::size_t, c_Bound> counts{};
+		constexpr std::size_t c_Samples = 120000;
+		for (std::size_t i = 0; i < c_Samples; i++) {
+			const auto value = generator.NextBounded(c_Bound);
+			ASSERT_LT(value, c_Bound);
+			counts[value]++;
+		}
+		// Every value should be drawn roughly the same amount of times
+		for (const auto count : counts) {
+			EXPECT_NEAR(static_cast<double>(count), static_cast<double>(c_Samples / c_Bound), c_Samples / c_Bound * 0.05);
+		}
+	}
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <util/StopToken.hpp>
+#include <util/ThreadPool.hpp>
+
+#include <chrono>
+#include <future>
+#include <vector>
+
+namespace Alphalcazar::Utils {
+	TEST(StopToken, CopiesShareTheStop) {
+		const StopToken token;
+		const StopToken copy = token;
+		EXPECT_FALSE(token.HasDeadline());
+		EXPECT_FALSE(copy.StopRequested());
+
+		copy.RequestStop();
+		EXPECT_TRUE(token.StopRequested());
+
+		// Other tokens are independent
+		EXPECT_FALSE(StopToken{}.StopRequested());
+	}
+
+	TEST(StopToken, Deadline) {
+		const StopToken futureToken { StopToken::Clock::now() + std::chrono::hours(1) };
+		EXPECT_TRUE(futureToken.HasDeadline());
+		EXPECT_FALSE(futureToken.CheckDeadline());
+
+		// A passed deadline only stops the token once it is checked
+		const StopToken passedToken { StopToken::Clock::now() - std::chrono::seconds(1) };
+		EXPECT_FALSE(passedToken.StopRequested());
+		EXPECT_TRUE(passedToken.CheckDeadline());
+		EXPECT_TRUE(passedToken.StopRequested());
+	}
+
+	TEST(StopToken, Follow) {
+		const StopToken token;
+		const StopToken followedToken { StopToken::Clock::now() - std::chrono::seconds(1) };
+		token.Follow(followedToken);
+		// The followed token only stops this one once it is checked, whether it was stopped by its deadline or by a request
+		EXPECT_FALSE(token.StopRequested());
+		EXPECT_TRUE(token.CheckDeadline());
+		EXPECT_TRUE(followedToken.StopRequested());
+
+		const StopToken otherToken;
+		const StopToken requestedToken;
+		otherToken.Follow(requestedToken);
+		EXPECT_FALSE(otherToken.CheckDeadline());
+		requestedToken.RequestStop();
+		EXPECT_TRUE(otherToken.CheckDeadline());
+
+		// Stopping a token doesn't stop the token it follows
+		const StopToken leaderToken;
+		const StopToken followerToken;
+		followerToken.Follow(leaderToken);
+		followerToken.RequestStop();
+		EXPECT_FALSE(leaderToken.CheckDeadline());
+	}
+
+	TEST(StopToken, ThreadPoolDropsStoppedTasks) {
+		ThreadPool threadPool { 1 };
+		const StopToken token;
+
+		// Keep the only worker thread busy until all tasks are queued
+		std::promise<void> release;
+		auto blockingTask = threadPool.Execute([releaseFuture = release.get_future().share()]() { releaseFuture.wait(); return 0; });
+
+		std::vector<std::future<int>> tasks;
+		for (int i = 1; i <= 10; i++) {
+			tasks.emplace_back(threadPool.Execute([i]() { return i; }, token));
+		}
+		auto otherTask = threadPool.Execute([]() { return 11; }, StopToken{});
+		token.RequestStop();
+		release.set_value();
+
+		EXPECT_EQ(blockingTask.get(), 0);
+		for (auto& task : tasks) {
+			// Dropped tasks don't run and return a default constructed result
+			EXPECT_EQ(task.get(), 0);
+		}
+		EXPECT_EQ(otherTask.get(), 11);
+	}
+}
@@ -0,0 +1,344 @@
+#include <gtest/gtest.h>
+
+#include <util/ThreadPool.hpp>
+
+#include <array>
+#include <atomic>
+#include <numeric>
+#include <future>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Alphalcazar::Utils {
+	TEST(ThreadPool, ExecutesAllTasks) {
+		constexpr std::size_t taskCount = 10000;
+		ThreadPool threadPool { 4 };
+
+		std::vector<std::future<std::size_t>> results;
+		for (std::size_t i = 0; i < taskCount; i++) {
+			results.emplace_back(threadPool.Execute([i]() { return i * 2; }));
+		}
+		for (std::size_t i = 0; i < taskCount; i++) {
+			EXPECT_EQ(results[i].get(), i * 2);
+		}
+	}
+
+	TEST(ThreadPool, Shared) {
+		ThreadPool& sharedThreadPool = ThreadPool::GetShared();
+		EXPECT_EQ(&ThreadPool::GetShared(), &sharedThreadPool);
+		EXPECT_GE(sharedThreadPool.GetThreadCount(), 1);
+		EXPECT_EQ(sharedThreadPool.Execute([]() { return 1; }).get(), 1);
+	}
+
+	TEST(ThreadPool, WorkerOptions) {
+		ThreadPoolOptions options;
+		options.ThreadCount = 2;
+		options.PinThreads = true;
+		// Larger than the default stack of the threads (8 MiB with glibc)
+		options.StackSize = 32 * 1024 * 1024;
+#if defined(__linux__)
+		// Both workers are pinned to the first core the process may run on
+		cpu_set_t allowedCores;
+		ASSERT_EQ(sched_getaffinity(0, sizeof(allowedCores), &allowedCores), 0);
+		std::size_t core = 0;
+		while (!CPU_ISSET(core, &allowedCores)) {
+			core++;
+		}
+		options.Cores = { core };
+#endif
+		ThreadPool threadPool { options };
+		EXPECT_EQ(threadPool.GetThreadCount(), 2);
+
+		// Waiting on the future doesn't help, so the task runs on a worker
+		threadPool.Execute([&options]() {
+			// A stack frame that only fits in the requested stack size
+			std::array<volatile std::uint8_t, 16 * 1024 * 1024> buffer;
+			buffer.front() = 1;
+			buffer.back() = 2;
+			EXPECT_EQ(buffer.front() + buffer.back(), 3);
+#if defined(__linux__)
+			pthread_attr_t attributes;
+			ASSERT_EQ(pthread_getattr_np(pthread_self(), &attributes), 0);
+			std::size_t stackSize = 0;
+			pthread_attr_getstacksize(&attributes, &stackSize);
+			pthread_attr_destroy(&attributes);
+			EXPECT_GE(stackSize, options.StackSize);
+
+			cpu_set_t workerCores;
+			ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(workerCores), &workerCores), 0);
+			EXPECT_EQ(CPU_COUNT(&workerCores), 1);
+			EXPECT_TRUE(CPU_ISSET(options.Cores.front(), &workerCores));
+			EXPECT_EQ(static_cast<std::size_t>(sched_getcpu()), options.Cores.front());
+#endif
+		}).get();
+
+		// The shared thread pool can't be configured anymore once it is started
+		ThreadPool::GetShared();
+		EXPECT_FALSE(ThreadPool::ConfigureShared(options));
+	}
+
+	TEST(ThreadPool, TasksCanQueueTasks) {
+		constexpr std::size_t taskCount = 100;
+		constexpr std::size_t subtaskCount = 100;
+		ThreadPool threadPool { 4 };
+		std::atomic<std::size_t> executedSubtasks = 0;
+
+		// Subtasks are queued from worker threads, on their own deques, and stolen by the other workers
+		std::vector<std::future<void>> results;
+		for (std::size_t i = 0; i < taskCount; i++) {
+			results.emplace_back(threadPool.Execute([&]() {
+				for (std::size_t j = 0; j < subtaskCount; j++) {
+					threadPool.Execute([&]() { executedSubtasks++; });
+				}
+			}));
+		}
+		for (auto& result : results) {
+			result.get();
+		}
+
+		while (executedSubtasks < taskCount * subtaskCount) {
+			std::this_thread::yield();
+		}
+		EXPECT_EQ(executedSubtasks, taskCount * subtaskCount);
+	}
+
+	TEST(ThreadPool, DestructionRunsQueuedTasks) {
+		std::atomic<std::size_t> executedTasks = 0;
+		{
+			ThreadPool threadPool { 2 };
+			for (std::size_t i = 0; i < 1000; i++) {
+				threadPool.Execute([&]() { executedTasks++; });
+			}
+		}
+		EXPECT_EQ(executedTasks, 1000);
+	}
+
+	TEST(ThreadPool, LatchCountsTasks) {
+		constexpr std::size_t taskCount = 1000;
+		ThreadPool threadPool { 4 };
+		TaskLatch latch;
+		EXPECT_TRUE(latch.IsDone());
+
+		std::vector<std::size_t> results(taskCount, 0);
+		for (std::size_t i = 0; i < taskCount; i++) {
+			threadPool.Execute([&results, i]() { results[i] = i; }, latch);
+		}
+		latch.Wait();
+		EXPECT_TRUE(latch.IsDone());
+		for (std::size_t i = 0; i < taskCount; i++) {
+			EXPECT_EQ(results[i], i);
+		}
+
+		// Tasks that don't fit in the storage of a task are allocated separately
+		std::array<std::size_t, ThreadPool::c_TaskStorageSize> values;
+		std::iota(values.begin(), values.end(), 0);
+		std::size_t sum = 0;
+		threadPool.Execute([values, &sum]() { sum = std::accumulate(values.begin(), values.end(), std::size_t{ 0 }); }, latch);
+		EXPECT_TRUE(latch.WaitFor(std::chrono::seconds(10)));
+		EXPECT_EQ(sum, ThreadPool::c_TaskStorageSize * (ThreadPool::c_TaskStorageSize - 1) / 2);
+	}
+
+	TEST(ThreadPool, LatchDropsStoppedTasks) {
+		ThreadPool threadPool { 1 };
+		const StopToken token;
+		TaskLatch blockerLatch;
+		TaskLatch latch;
+
+		// Keep the only worker thread busy until all tasks are queued
+		std::promise<void> unblock;
+		threadPool.Execute([blocker = unblock.get_future().share()]() { blocker.wait(); }, blockerLatch);
+
+		std::atomic<std::size_t> executedTasks = 0;
+		for (std::size_t i = 0; i < 10; i++) {
+			threadPool.Execute([&executedTasks]() { executedTasks++; }, latch, token);
+		}
+		token.RequestStop();
+		EXPECT_FALSE(latch.WaitFor(std::chrono::milliseconds(1)));
+		unblock.set_value();
+
+		// Dropped tasks are still counted down
+		latch.Wait();
+		blockerLatch.Wait();
+		EXPECT_EQ(executedTasks, 0);
+	}
+
+	TEST(ThreadPool, ParallelFor) {
+		ThreadPool threadPool { 3 };
+		std::vector<std::atomic<std::size_t>> timesVisited(1000);
+		threadPool.ParallelFor(10, timesVisited.size(), [&timesVisited](std::size_t i) { timesVisited[i]++; }, 7);
+		for (std::size_t i = 0; i < timesVisited.size(); i++) {
+			EXPECT_EQ(timesVisited[i], i < 10 ? 0 : 1) << "Index " << i;
+		}
+
+		// Empty ranges don't run anything
+		threadPool.ParallelFor(5, 5, [](std::size_t) { FAIL(); });
+	}
+
+	TEST(ThreadPool, NestedWaitsDontDeadlock) {
+		// With a single worker thread, the nested loops can only finish if the waiting threads run the queued tasks themselves
+		ThreadPool threadPool { 1 };
+		std::atomic<std::size_t> visitedIndices = 0;
+		threadPool.ParallelFor(0, 8, [&](std::size_t) {
+			threadPool.ParallelFor(0, 8, [&](std::size_t) {
+				threadPool.ParallelFor(0, 8, [&](std::size_t) { visitedIndices++; });
+			});
+		});
+		EXPECT_EQ(visitedIndices, 8 * 8 * 8);
+
+		TaskLatch latch;
+		threadPool.Execute([&]() {
+			TaskLatch nestedLatch;
+			threadPool.Execute([&]() { visitedIndices++; }, nestedLatch);
+			threadPool.Wait(nestedLatch);
+		}, latch);
+		threadPool.Wait(latch);
+		EXPECT_EQ(visitedIndices, 8 * 8 * 8 + 1);
+	}
+
+	TEST(ThreadPool, WaitForTimesOut) {
+		ThreadPool threadPool { 1 };
+		TaskLatch latch;
+		std::promise<void> started;
+		std::promise<void> unblock;
+		threadPool.Execute([&started, blocker = unblock.get_future().share()]() {
+			started.set_value();
+			blocker.wait();
+		}, latch);
+		// Otherwise the waiting thread could pick up the blocking task itself
+		started.get_future().wait();
+
+		EXPECT_FALSE(threadPool.WaitFor(latch, std::chrono::milliseconds(1)));
+		unblock.set_value();
+		EXPECT_TRUE(threadPool.WaitFor(latch, std::chrono::seconds(10)));
+	}
+
+	TEST(ThreadPool, PriorityLanes) {
+		ThreadPool threadPool { 1 };
+		TaskLatch latch;
+
+		// Keep the only worker thread busy until all tasks are queued
+		std::promise<void> started;
+		std::promise<void> unblock;
+		threadPool.Execute([&started, blocker = unblock.get_future().share()]() {
+			started.set_value();
+			blocker.wait();
+		}, latch);
+		started.get_future().wait();
+
+		std::mutex orderMutex;
+		std::vector<TaskPriority> order;
+		const auto queueTask = [&](TaskPriority priority) {
+			const TaskPriorityScope priorityScope { priority };
+			threadPool.Execute([&]() {
+				std::lock_guard lock { orderMutex };
+				order.push_back(TaskPriorityScope::GetCurrent());
+			}, latch);
+		};
+		for (std::size_t i = 0; i < 3; i++) {
+			queueTask(TaskPriority::BACKGROUND);
+			queueTask(TaskPriority::NORMAL);
+		}
+		EXPECT_EQ(TaskPriorityScope::GetCurrent(), TaskPriority::NORMAL);
+		unblock.set_value();
+		latch.Wait();
+
+		// The normal tasks are picked up first, whatever the order they were queued in
+		const std::vector<TaskPriority> expectedOrder { TaskPriority::NORMAL, TaskPriority::NORMAL, TaskPriority::NORMAL, TaskPriority::BACKGROUND, TaskPriority::BACKGROUND, TaskPriority::BACKGROUND };
+		EXPECT_EQ(order, expectedOrder);
+	}
+
+	TEST(ThreadPool, BackgroundTasksYield) {
+		ThreadPool threadPool { 1 };
+		TaskLatch latch;
+		std::promise<void> started;
+		std::promise<void> normalTaskQueued;
+		std::atomic<bool> shouldYield = false;
+		std::atomic<TaskPriority> nestedTaskPriority = TaskPriority::NORMAL;
+		{
+			const TaskPriorityScope priorityScope { TaskPriority::BACKGROUND };
+			threadPool.Execute([&, normalTaskQueuedFuture = normalTaskQueued.get_future().share()]() {
+				EXPECT_FALSE(threadPool.ShouldYield());
+				started.set_value();
+				normalTaskQueuedFuture.wait();
+				shouldYield = threadPool.ShouldYield();
+
+				// Tasks queued by a task inherit its priority
+				threadPool.Execute([&]() { nestedTaskPriority = TaskPriorityScope::GetCurrent(); }, latch);
+			}, latch);
+		}
+
+		started.get_future().wait();
+		threadPool.Execute([]() {}, latch);
+		normalTaskQueued.set_value();
+		// Without helping, so that the normal task stays queued until the background task checks it
+		latch.Wait();
+		EXPECT_TRUE(shouldYield);
+		EXPECT_EQ(nestedTaskPriority, TaskPriority::BACKGROUND);
+	}
+
+	TEST(ThreadPool, WaitRunsBackgroundTasksOfTheLatch) {
+		ThreadPool threadPool { 1 };
+		TaskLatch blockerLatch;
+		TaskLatch backgroundLatch;
+		std::promise<void> started;
+		std::promise<void> unblock;
+		std::atomic<bool> backgroundTaskRun = false;
+		// The only worker queues a background task and stays busy, so only the waiting thread can run it
+		threadPool.Execute([&, blocker = unblock.get_future().share()]() {
+			{
+				const TaskPriorityScope priorityScope { TaskPriority::BACKGROUND };
+				threadPool.Execute([&]() { backgroundTaskRun = true; }, backgroundLatch);
+			}
+			started.set_value();
+			blocker.wait();
+		}, blockerLatch);
+		started.get_future().wait();
+
+		EXPECT_TRUE(threadPool.WaitFor(backgroundLatch, std::chrono::seconds(10)));
+		EXPECT_TRUE(backgroundTaskRun);
+		unblock.set_value();
+		threadPool.Wait(blockerLatch);
+	}
+
+	TEST(ThreadPool, Statistics) {
+		ThreadPool threadPool { 2 };
+		TaskLatch latch;
+		for (std::size_t i = 0; i < 100; i++) {
+			threadPool.Execute([]() {}, latch);
+		}
+		latch.Wait();
+
+		auto statistics = threadPool.GetStatistics();
+		ASSERT_EQ(statistics.Workers.size(), 2);
+		EXPECT_EQ(statistics.QueuedTasks, 100);
+		EXPECT_GE(statistics.MaxPendingTasks, 1);
+		auto total = statistics.GetTotal();
+		EXPECT_EQ(total.ExecutedTasks, 100);
+		EXPECT_EQ(total.InjectedTasks, 100);
+		EXPECT_EQ(std::accumulate(total.TaskLatencies.begin(), total.TaskLatencies.end(), std::uint64_t{ 0 }), 100);
+		EXPECT_GT(statistics.GetTaskLatencyPercentile(1.0).count(), 0);
+
+		// Tasks queued by a worker go to its own deque. Waiting without helping, so that the first task runs on a worker.
+		threadPool.Execute([&threadPool]() {
+			TaskLatch nestedLatch;
+			for (std::size_t i = 0; i < 100; i++) {
+				threadPool.Execute([]() {}, nestedLatch);
+			}
+			threadPool.Wait(nestedLatch);
+		}, latch);
+		latch.Wait();
+
+		statistics = threadPool.GetStatistics();
+		total = statistics.GetTotal();
+		EXPECT_EQ(statistics.QueuedTasks, 201);
+		EXPECT_EQ(total.ExecutedTasks, 201);
+		// Only the first task was injected, the nested ones were either popped by their worker or stolen
+		EXPECT_EQ(total.InjectedTasks, 101);
+		EXPECT_LE(total.InjectedTasks + total.StolenTasks, total.ExecutedTasks);
+		EXPECT_GE(std::max(statistics.Workers[0].MaxQueuedTasks, statistics.Workers[1].MaxQueuedTasks), 1);
+	}
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <util/WorkStealingDeque.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Alphalcazar::Utils {
+	TEST(WorkStealingDeque, PopIsLifoAndStealIsFifo) {
+		WorkStealingDeque<int> deque { 2 };
+		EXPECT_FALSE(deque.Pop().has_value());
+		EXPECT_FALSE(deque.Steal().has_value());
+
+		// Pushing more items than the initial capacity grows the deque
+		for (int i = 0; i < 10; i++) {
+			deque.Push(i);
+		}
+		EXPECT_EQ(deque.ApproximateSize(), 10);
+
+		EXPECT_EQ(deque.Pop(), 9);
+		EXPECT_EQ(deque.Steal(), 0);
+		EXPECT_EQ(deque.Pop(), 8);
+		EXPECT_EQ(deque.Steal(), 1);
+		EXPECT_EQ(deque.ApproximateSize(), 6);
+
+		for (int i = 2; i < 8; i++) {
+			EXPECT_EQ(deque.Steal(), i);
+		}
+		EXPECT_FALSE(deque.Pop().has_value());
+		EXPECT_FALSE(deque.Steal().has_value());
+	}
+
+	TEST(WorkStealingDeque, ConcurrentStealsTakeEveryItemOnce) {
+		constexpr int itemCount = 100000;
+		constexpr std::size_t thiefCount = 3;
+		WorkStealingDeque<int> deque { 16 };
+		std::vector<std::atomic<int>> timesTaken(itemCount);
+		std::atomic<bool> ownerDone = false;
+
+		std::vector<std::thread> thieves;
+		for (std::size_t i = 0; i < thiefCount; i++) {
+			thieves.emplace_back([&]() {
+				while (!ownerDone || deque.ApproximateSize() > 0) {
+					if (const auto item = deque.Steal()) {
+						timesTaken[*item]++;
+					}
+				}
+			});
+		}
+
+		// The owner pushes all items, popping some of them back as it goes
+		for (int i = 0; i < itemCount; i++) {
+			deque.Push(i);
+			if (i % 3 == 0) {
+				if (const auto item = deque.Pop()) {
+					timesTaken[*item]++;
+				}
+			}
+		}
+		while (const auto item = deque.Pop()) {
+			timesTaken[*item]++;
+		}
+		ownerDone = true;
+		for (auto& thief : thieves) {
+			thief.join();
+		}
+
+		for (int i = 0; i < itemCount; i++) {
+			EXPECT_EQ(timesTaken[i], 1) << "Item " << i;
+		}
+	}
+}